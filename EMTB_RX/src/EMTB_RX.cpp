@@ -1,5 +1,7 @@
 #include <Arduino.h>
 #include <FastLED.h>
+#include <LedPower.h>
+#include <MotorControl.h>
 #include <RF24.h> //<SPI.h> included
 #include <RF24_config.h>
 #include <VescUart.h>        //VESC
@@ -44,19 +46,32 @@ const uint32_t fwd_on = 200;
 const uint32_t fwd_off = 500;
 const uint32_t break_on = 500;
 const uint32_t break_off = 100;
+const uint8_t cmdPeriod = 20;       // [ms] exactly one current command per period
+const uint16_t rampDriveUp = 1000;  // [mA/period] 50A/s  more motor current
+const uint16_t rampDriveDown = 4000;// [mA/period] 200A/s less motor current
+const uint16_t rampBrakeUp = 1000;  // [mA/period] 50A/s  more brake current
+const uint16_t rampBrakeDown = 4000;// [mA/period] 200A/s less brake current
+const int32_t cruiseMinRpm = 2000;  // [erpm] cruise only engages above
+const uint16_t rampRpm = 100;       // [erpm/period] the held speed follows the set speed with this rate
+const uint8_t nudgeRpm = 40;        // [erpm/period] set speed change with full stick in cruise
+const int8_t cruiseCancel = -64;    // braking harder ends cruise until the button is released
+const uint16_t ledMaxPower = 3000;  // [mW] LED budget, brightness is reduced above
 
 uint32_t timeLastRemote;
-uint8_t lastDuty;
 uint32_t lastLED;
 bool LEDstate; // bit0 --> 1=BREAK 0=FWD // bit1 --> 1=ON 0=OFF
 bool startSendingToVESC = false;
 uint32_t timeWaiting;
 uint32_t _millis;
+MotorControl control; // one current or rpm command per cmdPeriod
 
 struct RemoteDataStruct RemoteData;
 
 struct bldcMeasure VescMeasuredValues;
 
+void showLeds();
+void sendCommand();
+
 const struct LEDdata {
   const uint8_t count = 14;
   uint32_t fwd_on = 200;
@@ -69,17 +84,28 @@ const struct LEDdata {
 RF24 radio(7, 8);
 
 // Define the array of leds
+// Write them only through ledPower, it keeps the channel sums for the power estimate
 CRGB led_fwd[ledCount];
 CRGB led_back[ledCount];
+LedPower ledPower;
 
 void setup() {
 
   FastLED.addLeds<WS2812B, PIN_LED_FWD, RGB>(led_fwd, ledCount);
   FastLED.addLeds<WS2812B, PIN_LED_BACK, RGB>(led_back, ledCount);
 
-  fill_solid(led_fwd, ledCount, CRGB(0, 50, 0));  // slight green
-  fill_solid(led_back, ledCount, CRGB(0, 0, 50)); // slight blue
-  FastLED.show();
+  ledPower.fill(led_fwd, ledCount, CRGB(0, 50, 0));  // slight green
+  ledPower.fill(led_back, ledCount, CRGB(0, 0, 50)); // slight blue
+  showLeds();
+
+  // No output until the remote sends its limits
+  RemoteData._deadband = deadband;
+  RemoteData._amp_fwd = amp_fwd;
+  RemoteData._amp_break = amp_break;
+
+  control.period(cmdPeriod);
+  control.ramps(rampDriveUp, rampDriveDown, rampBrakeUp, rampBrakeDown);
+  control.cruise(cruiseMinRpm, rampRpm, nudgeRpm, cruiseCancel);
 
   // Setup UART port
   Serial.begin(115200);
@@ -102,9 +128,9 @@ void setup() {
   radio.printDetails();   // Dump the configuration for debugging
   radio.powerUp();        // Leave low-power mode - making radio more responsive. // powerDown() for low-power
 
-  fill_solid(led_fwd, ledCount, CRGB(230, 230, 255)); // white (blueish) front
-  fill_solid(led_back, ledCount, CRGB(150, 0, 0));    // red rear
-  FastLED.show();
+  ledPower.fill(led_fwd, ledCount, CRGB(230, 230, 255)); // white (blueish) front
+  ledPower.fill(led_back, ledCount, CRGB(150, 0, 0));    // red rear
+  showLeds();
 }
 
 void loop() {
@@ -112,6 +138,7 @@ void loop() {
 
   // Get values from VESC
   // Fill FIFO with AckPayload, for next return
+  VescUartRequestValues();
   if (VescUartGetValue(VescMeasuredValues) && radio.available()) {
     radio.writeAckPayload(pipe, &VescMeasuredValues, sizeof(VescMeasuredValues));
   }
@@ -127,34 +154,19 @@ void loop() {
     if ((millis() - timeLastRemote) > timeout) {
       RemoteData.thr = 0;
       RemoteData.cruise = false;
+      RemoteData._deadband = deadband;
+      RemoteData._amp_fwd = amp_fwd;
+      RemoteData._amp_break = amp_break;
     }
   }
 
   if (startSendingToVESC) {
-    // Set Duty once if over 5%, else reset duty and apply current
-    if (RemoteData.cruise) {
-      if (lastDuty == 0 && VescMeasuredValues.duty_now > 5) {
-        lastDuty = VescMeasuredValues.duty_now;
-        VescUartSetDuty(lastDuty);
-      }
-    } else {
-      // Set VESC currents && reset lastDuty
-      lastDuty = 0;
-      LEDstate &= 0b10;
-      if (RemoteData.thr > deadband) {
-        VescUartSetCurrent(RemoteData.thr * (amp_fwd / 2.0) / 127.0);
-
-      } else if (RemoteData.thr < -deadband) {
-        VescUartSetCurrentBrake(RemoteData.thr * (amp_break / 5.0) / -127.0);
-        LEDstate |= 0b01;
-      } else {
-        VescUartSetCurrent(0);
-        VescUartSetCurrentBrake(0);
-      }
-    }
+    // Hold the speed in cruise, else apply current
+    if (control.update(RemoteData, VescMeasuredValues))
+      sendCommand();
   } else {
     _millis = millis();
-    if (abs(RemoteData.thr) - deadband < 10) {
+    if (abs(RemoteData.thr) - RemoteData._deadband < 10) {
       if (timeWaiting == 0) {
         timeWaiting = _millis;
       }
@@ -170,23 +182,23 @@ void loop() {
   uint32_t compTime;
   if (LEDstate & 1 << 1) { // if ON
     for (int i = 2; i < 12; i++) {
-      led_back[i] = CRGB(150, 0, 0);
+      ledPower.set(&led_back[i], CRGB(150, 0, 0));
     }
     if (LEDstate & 1) { // BREAK
       compTime = LED_const.break_on;
-      led_back[0] = CRGB::Red;
-      led_back[1] = CRGB::Red;
-      led_back[12] = CRGB::Red;
-      led_back[13] = CRGB::Red;
+      ledPower.set(&led_back[0], CRGB::Red);
+      ledPower.set(&led_back[1], CRGB::Red);
+      ledPower.set(&led_back[12], CRGB::Red);
+      ledPower.set(&led_back[13], CRGB::Red);
     } else { // FWD
       compTime = LED_const.fwd_on;
-      led_back[0] = CRGB(150, 0, 0);
-      led_back[1] = CRGB(150, 0, 0);
-      led_back[12] = CRGB(150, 0, 0);
-      led_back[13] = CRGB(150, 0, 0);
+      ledPower.set(&led_back[0], CRGB(150, 0, 0));
+      ledPower.set(&led_back[1], CRGB(150, 0, 0));
+      ledPower.set(&led_back[12], CRGB(150, 0, 0));
+      ledPower.set(&led_back[13], CRGB(150, 0, 0));
     }
   } else {                                         // if OFF
-    fill_solid(led_back, ledCount, CRGB(0, 0, 0)); // clear() only available for ALL Leds
+    ledPower.fill(led_back, ledCount, CRGB(0, 0, 0)); // clear() only available for ALL Leds
     if (LEDstate & 1) {                            // BREAK
       compTime = LED_const.break_off;
     } else { // FWD
@@ -196,7 +208,32 @@ void loop() {
 
   _millis = millis();
   if (_millis - lastLED > compTime) {
-    FastLED.show();
+    showLeds();
     lastLED = _millis;
   }
 }
+
+// Caps the brightness to ledMaxPower from the sums, no scan of the leds, and reports the power with the telemetry
+void showLeds() {
+  uint32_t power = ledPower.power(2 * ledCount);
+  uint8_t brightness = ledPower.brightness(2 * ledCount, 255, ledMaxPower);
+  FastLED.setBrightness(brightness);
+  FastLED.show();
+  VescMeasuredValues.led_power = power * brightness / 256;
+}
+
+// Sends the command of this period, the rear lights show the brake
+void sendCommand() {
+  LEDstate &= 0b10;
+  switch (control.command()) {
+  case COMM_SET_RPM:
+    VescUartSetRPM(control.value());
+    break;
+  case COMM_SET_CURRENT_BRAKE:
+    VescUartSetCurrentBrakeMilli(control.value());
+    LEDstate |= 0b01;
+    break;
+  default:
+    VescUartSetCurrentMilli(control.value());
+  }
+}
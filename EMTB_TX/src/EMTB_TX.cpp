@@ -21,11 +21,14 @@
  TFT_PINK        0xF81F
 */
 
-#include <Bounce2.h>
+#include <PortBounce.h>
 #include <EEPROM.h>
+#include <EEStore.h>
+#include <EnergyMeter.h>
 #include <RF24.h>
 #include <RF24_config.h>
 #include <SD.h>
+#include <SDLog.h>
 #include <SPI.h>
 #include <TFT_ST7735.h>
 #include <buffer.h>          //VESC
@@ -72,14 +75,27 @@ Button Settings <-- 3			A2 --> Poti(FWD)
 const uint8_t channel = 77;
 const uint64_t pipe = 0x52582d5458;                                                                         // 'RX-TX' pipe
 const uint32_t time_settings = 4095;                                                                        // [ms]
-const uint8_t eeDeadband = 0;                                                                               // EEPROM Address
-const uint8_t eeFwdMax = 1;                                                                                 // EEPROM Address
-const uint8_t eeBreakMax = 2;                                                                               // EEPROM Address
-const uint8_t eeFwdMin = 3;                                                                                 // EEPROM Address
-const uint8_t eeBreakMin = 4;                                                                               // EEPROM Address
-const uint8_t eeMaxVolt = 5;                                                                                // EEPROM Address
+const uint8_t eeDeadband = 0;                                                                               // EEPROM Address of older firmware, only read to migrate
+const uint8_t eeFwdMax = 1;                                                                                 // EEPROM Address of older firmware, only read to migrate
+const uint8_t eeBreakMax = 2;                                                                               // EEPROM Address of older firmware, only read to migrate
+const uint8_t eeFwdMin = 3;                                                                                 // EEPROM Address of older firmware, only read to migrate
+const uint8_t eeBreakMin = 4;                                                                               // EEPROM Address of older firmware, only read to migrate
+const uint8_t eeMaxVolt = 5;                                                                                // EEPROM Address of older firmware, only read to migrate
+const uint16_t eeSettings = 16;                                                                             // EEPROM Address of the settings slots
+const uint8_t eeSlots = 64;                                                                                 // settings slots for wear levelling, 10 bytes each
+const uint8_t settingsVersion = 1;                                                                          // change when settingsStruct changes
 const uint16_t TFTrefresh = 500;                                                                            // [ms]
-const uint16_t SDrefresh = 500;                                                                             // [ms]
+const uint16_t TFTchunk = 640;                                                                              // [pixels] painted per loop at most, 1.3kB of SPI or 2.7ms
+const uint8_t batChunk = 22;                                                                                // battery lines painted per loop at most, 29 pixels each
+const uint16_t SDrefresh = 100;                                                                             // [ms]
+const uint16_t SDsync = 5000;                                                                               // [ms] commit the log at least this often
+const uint16_t SDextent = 32768;                                                                            // [sectors] 16MB log file allocated at once, 8h at the rate of tx_loop_bench
+const uint8_t tickPeriod = 20;                                                                              // [ms] one sample per RX command period into the event ring
+const uint8_t tickBytes = 255;                                                                              // delta encoded samples of the event ring, about 1s
+const uint8_t radioFailStreak = 3;                                                                          // failed radio.write() in a row for LOG_EVT_RADIO
+const uint16_t linkTimeout = 250;                                                                           // [ms] without ack for LOG_EVT_LINK
+const int16_t sagVolts = 20;                                                                                // [0.1V] v_in drop since the last logged sample for LOG_EVT_SAG
+const int32_t spikeAmps = 6000;                                                                             // [0.01A] motor current for LOG_EVT_SPIKE
 const uint8_t wheelsize = 200;                                                                              // [mm]
 const uint8_t gearratio = 3;                                                                                // [1:X]
 const uint8_t pulse_rpm = 42;                                                                               // Number of poles * 3
@@ -87,26 +103,74 @@ const uint8_t erpm_rpm = 7;
 const float dist_corr_factor = 0.8;                                                                         // Number of polse / 2
 const float ratio_RpmSpeed = (wheelsize * 3.141 * 60) / (erpm_rpm * gearratio * 1000000);                   // ERPM to km/h
 const float ratio_TachoDist = ((wheelsize * 3.141) / (pulse_rpm * gearratio * 1000000)) * dist_corr_factor; // pulses to km
+const uint32_t pulses_km = 1 / ratio_TachoDist;                                                             // tachometer pulses per km
+const uint16_t batteryWh = 360;                                                                             // [Wh] usable capacity for the range
+const uint16_t batteryRes = 150;                                                                            // [mOhm] internal resistance until the first estimate
+const int16_t startWhKm = 200;                                                                              // [0.1Wh/km] consumption for the range of the first 100 m
 const uint16_t waitBeforeSend = 5000;                                                                       //[ms]
+const uint16_t menuRepeatDelay = 500;                                                                       // [ms] stick held until a value starts to repeat
+const uint16_t menuRepeatStart = 200;                                                                       // [ms] first repeat interval, halves every 5 repeats
+const uint8_t menuRepeatMin = 25;                                                                           // [ms] fastest repeat interval
+const uint8_t batTop = 3;                                                                                   // first line inside the battery
+const uint8_t batEmpty = 94;                                                                                // one below the last line inside the battery
+
+// Battery fill colour for every line from batTop, green at the top to red at the bottom
+// Generated with the former gradientRYG(map(line, 3, 94, 255, 0))
+const uint16_t batGradient[91] PROGMEM = {
+  0x07E0, 0x07E0, 0x0FE0, 0x17E0, 0x17E0, 0x1FE0, 0x27E0, 0x27E0,
+  0x2FE0, 0x37E0, 0x3FE0, 0x3FE0, 0x47E0, 0x4FE0, 0x4FE0, 0x57E0,
+  0x5FE0, 0x5FE0, 0x67E0, 0x6FE0, 0x77E0, 0x77E0, 0x7FE0, 0x87E0,
+  0x87E0, 0x8FE0, 0x97E0, 0x97E0, 0x9FE0, 0xA7E0, 0xAFE0, 0xAFE0,
+  0xB7E0, 0xBFE0, 0xBFE0, 0xC7E0, 0xCFE0, 0xCFE0, 0xD7E0, 0xDFE0,
+  0xE7E0, 0xE7E0, 0xEFE0, 0xF7E0, 0xF7E0, 0xFFE0, 0xFFF0, 0xFFC0,
+  0xFF90, 0xFF60, 0xFF30, 0xFF10, 0xFEE0, 0xFEB0, 0xFE80, 0xFE50,
+  0xFE30, 0xFE00, 0xFDD0, 0xFDA0, 0xFD70, 0xFD50, 0xFD20, 0xFCF0,
+  0xFCC0, 0xFC90, 0xFC70, 0xFC40, 0xFC10, 0xFBE0, 0xFBB0, 0xFB90,
+  0xFB60, 0xFB30, 0xFB00, 0xFAD0, 0xFAB0, 0xFA80, 0xFA50, 0xFA20,
+  0xF9F0, 0xF9D0, 0xF9A0, 0xF970, 0xF940, 0xF910, 0xF8F0, 0xF8C0,
+  0xF890, 0xF860, 0xF830};
 
 // globals
 uint32_t TFTlastPaint;
+uint8_t paintStage; // next field drawValues() paints, 0 = screen is up to date
 uint32_t SDlastPrint;
-uint32_t SettingsBtnPushTime;
 uint32_t ridetime;
 bool SendEnabled;
 bool hasSDcard;
-bool batteryNorm;
-uint8_t amp_fwd_max;   // factor 0.5A
-uint8_t amp_break_max; // factor 0.1A
-uint8_t amp_fwd_min;   // factor 0.5A
-uint8_t amp_break_min; // factor 0.1A
-uint8_t maxvolt;       // factor 0.2A
+
+// settings, the RAM copy of the EEPROM record
+struct settingsStruct {
+  uint8_t deadband;
+  uint8_t amp_fwd_max;   // factor 0.5A
+  uint8_t amp_break_max; // factor 0.1A
+  uint8_t amp_fwd_min;   // factor 0.5A
+  uint8_t amp_break_min; // factor 0.1A
+  uint8_t maxvolt;       // factor 0.2V
+};
+const settingsStruct settingsDefault PROGMEM = {10, 60, 100, 20, 20, 210}; // used if the EEPROM has no valid record
+const settingsStruct settingsMin PROGMEM = {0, 2, 5, 0, 0, 60};            // menu limits, 3S
+const settingsStruct settingsMax PROGMEM = {60, 254, 250, 254, 250, 252};  // menu limits, 12S
+settingsStruct settings;
+EEStore settingsStore(eeSettings, eeSlots);
+
 uint8_t old_amp_fwd;
 uint8_t old_amp_break;
+int32_t old_tachometerAbs; // the VESC value on the screen
 uint8_t battery;
-uint8_t old_battery;
-uint8_t lastBatLine;
+uint8_t lastBatLine = batEmpty;
+uint16_t batteryOutline;
+
+// event triggers
+uint8_t radioFails;  // failed radio.write() in a row
+uint32_t lastAck;    // millis() of the last acknowledged packet
+uint8_t eventActive; // LOG_EVT_ conditions of the last loop, events fire on the rising edge
+
+// timing, logged to find stick-to-motor lag and stale values in the field
+uint32_t lastLoop;
+uint16_t loopMs;  // [ms] between the last two loops
+uint16_t loopMax; // [ms] longest loop since the last logged sample
+uint32_t lastVesc; // millis() when the VESC values arrived
+int16_t sagRef;      // v_in of the last logged sample
 
 // average
 uint16_t avgSum = 0;
@@ -114,30 +178,100 @@ const uint8_t avgCnt = 10;
 uint8_t avg[avgCnt];
 uint8_t avgIdx = 0;
 
-File logfile;
+SDLog logger;
+EnergyMeter meter;
+
+numberslot speedSlot;
+numberslot voltSlot;
+numberslot motorSlot;
+numberslot dutySlot;
+numberslot rangeSlot;
 
 struct RemoteDataStruct RemoteData;
 
 struct bldcMeasure VescMeasuredValues;
-struct bldcMeasure VescOldValues;
+
+// Payload of a logged sample. The VESC values are kept in the fixed point
+// steps VescUart received them in, small integer steps delta encode well.
+struct logSample {
+  struct RemoteDataStruct remote;
+  int16_t current_motor;     // [0.01A]
+  int16_t current_in;        // [0.01A]
+  int16_t duty_now;          // [0.1%]
+  int32_t rpm;               // ERPM
+  int16_t v_in;              // [0.1V]
+  int32_t amp_hours;         // [0.1mAh]
+  int32_t amp_hours_charged; // [0.1mAh]
+  int32_t tachometerAbs;
+  uint8_t radio_fails; // failed radio.write() in a row
+  uint16_t loop_max;   // [ms] longest loop since the previous sample
+  uint16_t vesc_age;   // [ms] since the VESC values arrived
+  uint16_t led_power;  // [mW] of the RX light strips
+};
+
+// Field table written into the log header, lets the host tools decode logSample
+const logField logFields[] PROGMEM = {
+    {"thr", LOG_I8, offsetof(logSample, remote.thr), 1},
+    {"cruise", LOG_BOOL, offsetof(logSample, remote.cruise), 1},
+    {"deadband", LOG_U8, offsetof(logSample, remote._deadband), 1},
+    {"amp_fwd", LOG_U8, offsetof(logSample, remote._amp_fwd), 0.5},     // [A]
+    {"amp_break", LOG_U8, offsetof(logSample, remote._amp_break), 0.1}, // [A]
+    {"current_motor", LOG_I16, offsetof(logSample, current_motor), 0.01},
+    {"current_in", LOG_I16, offsetof(logSample, current_in), 0.01},
+    {"duty_now", LOG_I16, offsetof(logSample, duty_now), 0.001},
+    {"rpm", LOG_I32, offsetof(logSample, rpm), 1}, // ERPM
+    {"v_in", LOG_I16, offsetof(logSample, v_in), 0.1},
+    {"amp_hours", LOG_I32, offsetof(logSample, amp_hours), 0.0001},
+    {"amp_hours_charged", LOG_I32, offsetof(logSample, amp_hours_charged), 0.0001},
+    {"tachometerAbs", LOG_I32, offsetof(logSample, tachometerAbs), 1},
+    {"radio_fails", LOG_U8, offsetof(logSample, radio_fails), 1},
+    {"loop_max", LOG_U16, offsetof(logSample, loop_max), 1},
+    {"vesc_age", LOG_U16, offsetof(logSample, vesc_age), 1},
+    {"led_power", LOG_U16, offsetof(logSample, led_power), 1}};
+// Past these SDLog falls back to key frames only, which takes several times the card space
+static_assert(sizeof(logFields) / sizeof(logField) <= SDLOG_FIELDS, "more log fields than SDLOG_FIELDS");
+static_assert(sizeof(logSample) <= SDLOG_SAMPLE, "logSample larger than SDLOG_SAMPLE");
+
+// Event ring: the oldest sample whole, the ones after it delta encoded against the sample before,
+// like a LOG_REC_DELTA frame. An event writes it to the card as it is, in two frames.
+logSample tickFirst; // oldest sample in the ring
+logSample tickLast;  // newest, the reference of the next delta
+uint32_t tickFirstMs;
+uint32_t tickLastMs;
+uint8_t tickRing[tickBytes];
+uint8_t tickFill; // bytes in tickRing
+bool tickKept;    // tickFirst and tickLast are valid
+static_assert(tickBytes >= LOG_DELTA_MAX(sizeof(logFields) / sizeof(logField)), "tickBytes can't hold one delta");
+
+enum { alignLeft, alignCentre, alignRight }; // of drawText()
 
 // functions
+void drawText(const char *text, int x, int y, uint8_t font, uint8_t align);
 void drawLabels();
-void drawValues();
-uint16_t gradientRYG(uint8_t value);
+void exchangeRadio();
+uint8_t drawValues(uint8_t stage);
+void fillSample(logSample *sample, uint32_t now);
+uint16_t vescAge(uint32_t now);
+uint8_t checkEvents(uint32_t now);
+void keepTick(uint32_t now);
+void dropTick(const logSlot *slots);
+bool dumpTicks(uint8_t events);
 void drawBattery(uint16_t color);
-void fillBattery(uint8_t value);
+bool fillBattery(uint8_t value);
 void settingsMenu();
 void changeSettings(bool up, uint16_t currentS);
+void stepSetting(uint8_t &value, uint8_t offset, bool up);
+void clampSettings();
 void drawSettings();
 void drawSettingValues(uint16_t currentS);
+void drawSettingValue(uint8_t row, bool selected);
 void saveSettings();
 void discardSettings();
 
 // objects
 RF24 radio(PIN_RADIO_CS, PIN_RADIO_CE); // Set up nRF24L01 radio on SPI bus
 TFT_ST7735 tft = TFT_ST7735();          // pins defined in User_Setup.h // ToDo: Move pin definition to this file
-Bounce DEB_cruise = Bounce();
+PortBounce buttons; // all buttons are on PIND, bit = pin
 
 void setup() {
 
@@ -151,30 +285,45 @@ void setup() {
 
   analogWrite(PIN_TFT_LED, analogRead(PIN_POTI_LED) >> 2);
 
-  DEB_cruise.attach(PIN_BTN_CRUISE); // standard-interval 10 ms
+  buttons.attach(&PIND, _BV(PIN_BTN_CRUISE) | _BV(PIN_BTN_SETTINGS), _BV(PIN_BTN_SETTINGS)); // 4 samples of 5 ms
+  buttons.timing(time_settings, 300);
+
+  if (!settingsStore.begin(&settings, sizeof(settings), &settingsDefault, settingsVersion) && EEPROM.read(eeMaxVolt) != 0xFF) {
+    // Loose bytes of an older firmware, take them over into a record once
+    EEPROM.get(eeDeadband, settings.deadband);
+    EEPROM.get(eeFwdMax, settings.amp_fwd_max);
+    EEPROM.get(eeBreakMax, settings.amp_break_max);
+    EEPROM.get(eeFwdMin, settings.amp_fwd_min);
+    EEPROM.get(eeBreakMin, settings.amp_break_min);
+    EEPROM.get(eeMaxVolt, settings.maxvolt);
+    clampSettings();
+    settingsStore.save();
+    for (uint8_t addr = eeDeadband; addr <= eeMaxVolt; addr++)
+      EEPROM.update(addr, 0xFF); // migrated, never read again
+  }
+  RemoteData._deadband = settings.deadband;
 
-  EEPROM.get(eeDeadband, RemoteData._deadband);
-  EEPROM.get(eeFwdMax, amp_fwd_max);
-  EEPROM.get(eeBreakMax, amp_break_max);
-  EEPROM.get(eeFwdMin, amp_fwd_min);
-  EEPROM.get(eeBreakMin, amp_break_min);
-  EEPROM.get(eeMaxVolt, maxvolt);
+  meter.battery(settings.maxvolt * 2 * 5 / 7, settings.maxvolt * 2, batteryWh); // empty at 3.0V of 4.2V per cell
+  meter.distance(pulses_km);
+  meter.resistance(batteryRes);
+  meter.consumption(startWhKm);
 
   tft.init();
   tft.setRotation(0); // portrait
   tft.fillScreen(TFT_BLACK);
   tft.setTextColor(TFT_WHITE, TFT_BLACK);
   tft.setTextSize(2);
-  tft.drawCentreString("Start", 64, 40, 2);
+  drawText(PSTR("Start"), 64, 40, 2, alignCentre);
   tft.setTextSize(1);
   delay(2000);
   // Check if the button is pressed at startup.
   // Holding it down longer then "time_settings" will enter the settingsMenu and abort startup
   bool written = false;
-  while (digitalRead(PIN_BTN_SETTINGS)) {
+  while (buttons.read(PIN_BTN_SETTINGS)) {
+    buttons.update();
     if (!written) {
       tft.setTextColor(TFT_YELLOW, TFT_BLACK);
-      tft.drawCentreString("Settings", 64, 100, 2);
+      drawText(PSTR("Settings"), 64, 100, 2, alignCentre);
       written = true;
     }
     if (millis() > time_settings) {
@@ -183,15 +332,23 @@ void setup() {
   }
 
   tft.fillRect(10, 100, 109, 16, TFT_BLACK); // Overwrite "Settings"
-  tft.drawCentreString("Init", 64, 100, 2);
+  drawText(PSTR("Init"), 64, 100, 2, alignCentre);
 
-  if (!SD.begin(PIN_SDCARD_CS)) {
-    tft.drawCentreString("No SD Card", 0, 130, 2);
+  if (!SD.begin(PIN_SDCARD_CS) || !logger.begin(SDextent)) {
+    drawText(PSTR("No SD Card"), 0, 130, 2, alignCentre);
   } else {
     hasSDcard = true;
-    logfile = SD.open("logfile.txt", FILE_WRITE);
-    if (!logfile)
-      tft.drawCentreString("No SD Card", 0, 130, 2);
+    logger.syncInterval(SDsync);
+    logHeader header;
+    header.fields = sizeof(logFields) / sizeof(logField);
+    header.wheelsize = wheelsize;
+    header.gearratio = gearratio;
+    header.pulse_rpm = pulse_rpm;
+    header.erpm_rpm = erpm_rpm;
+    header.dist_corr_factor = dist_corr_factor;
+    header.ratio_RpmSpeed = ratio_RpmSpeed;
+    header.ratio_TachoDist = ratio_TachoDist;
+    logger.writeHeader(&header, logFields);
   }
 
   Serial.begin(115200);
@@ -213,11 +370,18 @@ void setup() {
   radio.powerUp(); // Leave low-power mode - making radio more responsive. // powerDown() for low-power
 
   tft.fillScreen(TFT_BLACK);
-  drawBattery(TFT_WHITE);
+  batteryOutline = TFT_WHITE;
+  drawBattery(batteryOutline);
   drawLabels();
 }
 
 void loop() {
+  uint32_t loopStart = millis();
+  loopMs = min(loopStart - lastLoop, 0xFFFFUL);
+  lastLoop = loopStart;
+  if (loopMs > loopMax)
+    loopMax = loopMs;
+
   // read POTI_THR and build average (we don't want a spiking throttle)
   avgSum -= avg[avgIdx];
   avg[avgIdx] = analogRead(PIN_POTI_THR);
@@ -228,21 +392,19 @@ void loop() {
     avgIdx = 0;
   RemoteData.thr = avgSum / avgCnt;
 
-  RemoteData._amp_fwd = map(analogRead(PIN_POTI_FWD), 0, 1023, amp_fwd_min, amp_fwd_max);
-  RemoteData._amp_break = map(analogRead(PIN_POTI_BREAK), 0, 1023, amp_break_min, amp_break_max);
+  RemoteData._amp_fwd = map(analogRead(PIN_POTI_FWD), 0, 1023, settings.amp_fwd_min, settings.amp_fwd_max);
+  RemoteData._amp_break = map(analogRead(PIN_POTI_BREAK), 0, 1023, settings.amp_break_min, settings.amp_break_max);
 
   // readButtons
-  DEB_cruise.update();
-  RemoteData.cruise = !DEB_cruise.read();
+  buttons.update();
+  RemoteData.cruise = buttons.read(PIN_BTN_CRUISE);
+  if (buttons.longPress(PIN_BTN_SETTINGS))
+    ridetime = millis(); // Reset Ridetime
 
+  // The radio goes first in every loop. After it the loop does one bounded piece of work:
+  // one card write, or one chunk of the screen of at most TFTchunk pixels.
   if (SendEnabled) {
-    // send values to RX
-    radio.write(&RemoteData, sizeof(RemoteData));
-
-    // recieve AckPayload
-    while (radio.isAckPayloadAvailable()) {
-      radio.read(&VescMeasuredValues, sizeof(VescMeasuredValues));
-    }
+    exchangeRadio();
   } else {
     if (millis() > waitBeforeSend)
       SendEnabled = true;
@@ -253,11 +415,27 @@ void loop() {
   bool SDsaved = false;
   if (hasSDcard) {
     _millis = millis();
+
+    // A sample every tickPeriod and at an event into the event ring, it only goes to the card when an event fires
+    uint8_t events = SendEnabled ? checkEvents(_millis) : 0;
+    if (events || _millis - tickLastMs >= tickPeriod)
+      keepTick(_millis);
+    if (events)
+      SDsaved = dumpTicks(events);
+
     if (_millis > SDlastPrint + SDrefresh) {
-      logfile.write((const uint8_t *)&RemoteData, sizeof(RemoteData));
-      logfile.write((const uint8_t *)&VescMeasuredValues, sizeof(VescMeasuredValues));
+      if (SDsaved) {
+        exchangeRadio(); // a packet between two card writes
+        _millis = millis();
+      }
+      // Only whole sectors go to the card, most calls just fill the logger buffer
+      logSample sample;
+      fillSample(&sample, _millis);
+      sample.loop_max = loopMax;
+      loopMax = 0;
+      SDsaved |= logger.writeSample(&sample);
+      sagRef = VescMeasuredValues.v_in;
       SDlastPrint = _millis;
-      SDsaved = true;
     }
   }
 
@@ -265,99 +443,229 @@ void loop() {
   if (!SDsaved) {
     // Write Average-Values to screen (if changed)
     _millis = millis(); // buffer 1x instead of 5x exec
-    if (_millis > TFTlastPaint + TFTrefresh) {
-      if (digitalRead(PIN_BTN_SETTINGS)) {
-        if (SettingsBtnPushTime == 0)
-          SettingsBtnPushTime = _millis;
-        if (_millis > SettingsBtnPushTime + time_settings) {
-          SettingsBtnPushTime = 0;
-          ridetime = _millis; // Reset Ridetime. This is inside the TFT Loop so it doesn't get called every loop.
-        }
-      } else {
-        SettingsBtnPushTime = 0;
-      }
+    if (paintStage == 0 && _millis > TFTlastPaint + TFTrefresh) {
       analogWrite(PIN_TFT_LED, analogRead(PIN_POTI_LED) >> 2); // Set TFT brightnes
 
-      drawValues();
-      VescOldValues = VescMeasuredValues;
-      old_amp_fwd = RemoteData._amp_fwd;
-      old_amp_break = RemoteData._amp_break;
+      paintStage = 1;
       TFTlastPaint = _millis;
     }
+    // Paint one chunk per loop, so a full repaint doesn't hold back the next radio packet.
+    // The radio and the SD card leave their own SPI settings behind, restore the TFT ones.
+    if (paintStage) {
+      tft.backupSPCR();
+      paintStage = drawValues(paintStage);
+      tft.restoreSPCR();
+    }
   }
 }
 
+// Sends the remote values to the RX and takes the VESC values of its ack payload
+void exchangeRadio() {
+  if (radio.write(&RemoteData, sizeof(RemoteData))) {
+    radioFails = 0;
+    lastAck = millis();
+  } else if (radioFails < 255) {
+    radioFails++;
+  }
+
+  // recieve AckPayload
+  bool received = false;
+  while (radio.isAckPayloadAvailable()) {
+    radio.read(&VescMeasuredValues, sizeof(VescMeasuredValues));
+    lastVesc = millis();
+    received = true;
+  }
+  if (received)
+    meter.update(VescMeasuredValues.v_in, VescMeasuredValues.current_in, VescMeasuredValues.amp_hours,
+                 VescMeasuredValues.amp_hours_charged, VescMeasuredValues.tachometerAbs);
+}
+
+// The values of this loop, loop_max is the time since the previous loop
+void fillSample(logSample *sample, uint32_t now) {
+  const bldcMeasure *vesc = &VescMeasuredValues;
+  sample->remote = RemoteData;
+  sample->current_motor = vesc->current_motor;
+  sample->current_in = vesc->current_in;
+  sample->duty_now = vesc->duty_now;
+  sample->rpm = vesc->rpm;
+  sample->v_in = vesc->v_in;
+  sample->amp_hours = vesc->amp_hours;
+  sample->amp_hours_charged = vesc->amp_hours_charged;
+  sample->tachometerAbs = vesc->tachometerAbs;
+  sample->radio_fails = radioFails;
+  sample->loop_max = loopMs;
+  sample->vesc_age = vescAge(now);
+  sample->led_power = vesc->led_power;
+}
+
+uint16_t vescAge(uint32_t now) {
+  return min(now - lastVesc, 0xFFFFUL);
+}
+
+// Returns the LOG_EVT_ conditions that started in this loop
+uint8_t checkEvents(uint32_t now) {
+  uint8_t active = 0;
+  uint8_t events;
+
+  if (now - lastAck > linkTimeout)
+    active |= LOG_EVT_LINK;
+  if (radioFails >= radioFailStreak)
+    active |= LOG_EVT_RADIO;
+  if (VescMeasuredValues.v_in < sagRef - sagVolts)
+    active |= LOG_EVT_SAG;
+  if (labs(VescMeasuredValues.current_motor) > spikeAmps)
+    active |= LOG_EVT_SPIKE;
+  if (RemoteData.thr < -RemoteData._deadband)
+    active |= LOG_EVT_BRAKE;
+
+  events = active & ~eventActive;
+  eventActive = active;
+  return events;
+}
+
+// Adds the values of this loop to the event ring, the oldest samples make room
+void keepTick(uint32_t now) {
+  const logSlot *slots;
+  uint8_t fields = logger.deltaSlots(&slots);
+  logSample sample;
+  uint8_t delta[LOG_DELTA_MAX(sizeof(logFields) / sizeof(logField))];
+
+  fillSample(&sample, now);
+  if (!tickKept || !fields) {
+    tickFirst = tickLast = sample;
+    tickFirstMs = tickLastMs = now;
+    tickFill = 0;
+    tickKept = true;
+    return;
+  }
+  uint8_t len = logEncodeDelta(delta, now - tickLastMs, slots, fields, (uint8_t *)&tickLast, (const uint8_t *)&sample) - delta;
+  tickLastMs = now;
+  while (tickFill + len > tickBytes)
+    dropTick(slots);
+  memcpy(tickRing + tickFill, delta, len);
+  tickFill += len;
+}
+
+// The oldest delta moves into tickFirst
+void dropTick(const logSlot *slots) {
+  const uint8_t *next = logApplyDelta(tickRing, &tickFirstMs, slots, (uint8_t *)&tickFirst);
+  tickFill -= next - tickRing;
+  memmove(tickRing, next, tickFill);
+}
+
+// Writes the event and the ring, oldest sample first, and empties the ring
+bool dumpTicks(uint8_t events) {
+  bool written;
+  if (tickKept)
+    written = logger.writeTicks(events, &tickFirst, tickFirstMs, tickRing, tickFill);
+  else
+    written = logger.writeRecord(LOG_REC_EVENT, &events, 1);
+  tickKept = false;
+  return written;
+}
+
+// Draws a PSTR() text, it only takes RAM while it is drawn
+void drawText(const char *text, int x, int y, uint8_t font, uint8_t align) {
+  char s[12];
+  strncpy_P(s, text, sizeof(s) - 1);
+  s[sizeof(s) - 1] = 0;
+  if (align == alignCentre)
+    tft.drawCentreString(s, x, y, font);
+  else if (align == alignRight)
+    tft.drawRightString(s, x, y, font);
+  else
+    tft.drawString(s, x, y, font);
+}
+
 void drawLabels() {
   tft.setTextColor(TFT_CYAN, TFT_BLACK);
-  tft.drawCentreString("km", 73, 0, 2);
-  tft.drawCentreString("h", 73, 15, 2);
+  drawText(PSTR("km"), 73, 0, 2, alignCentre);
+  drawText(PSTR("h"), 73, 15, 2, alignCentre);
   tft.drawFastHLine(65, 15, 16, TFT_CYAN);
-  tft.drawCentreString("Motor", 22, 74, 2);
-  tft.drawCentreString("Duty", 68, 74, 2);
-  tft.drawString("km", 51, 95, 2);
-  tft.drawCentreString(":", 38, 112, 2);
+  drawText(PSTR("Motor"), 22, 74, 2, alignCentre);
+  drawText(PSTR("Duty"), 68, 74, 2, alignCentre);
+  drawText(PSTR("km"), 51, 95, 2, alignLeft);
+  drawText(PSTR(":"), 38, 112, 2, alignCentre);
   tft.setTextColor(TFT_GREEN, TFT_BLACK);
-  tft.drawRightString("F", 125, 128, 2);
+  drawText(PSTR("F"), 125, 128, 2, alignRight);
   tft.setTextColor(TFT_RED, TFT_BLACK);
-  tft.drawRightString("B", 125, 144, 2);
+  drawText(PSTR("B"), 125, 144, 2, alignRight);
   tft.drawFastHLine(78, 126, 49, TFT_WHITE);
   tft.drawFastVLine(78, 126, 34, TFT_WHITE);
   tft.drawRect(4, 93, 66, 37, TFT_WHITE);
-}
 
-void drawValues() {
+  tft.setTextColor(TFT_WHITE, TFT_BLACK);
   tft.setTextSize(2);
-  tft.setTextPadding(56); // xx (font4 * 2)
-  tft.setTextColor(RemoteData.cruise ? TFT_GREEN : TFT_WHITE, TFT_BLACK);
-  if (VescMeasuredValues.rpm != VescOldValues.rpm)
-    tft.drawRightNumber(VescMeasuredValues.rpm * ratio_RpmSpeed, 62, 2, 4);
-
+  tft.initNumberSlot(&speedSlot, 62, 2, 4, 2, 0); // xx (font4 * 2)
   tft.setTextSize(1);
-  tft.setTextColor(TFT_WHITE, TFT_BLACK);
-  old_battery = battery;
-  battery = (VescMeasuredValues.v_in * 255) / (maxvolt / 5.0);
-  if (old_battery != battery)
-    fillBattery(battery);
-
-  tft.setTextPadding(30); // xx,x (font2)
-  if (RemoteData._amp_fwd != old_amp_fwd)
-    tft.drawFloat(RemoteData._amp_fwd / 2.0, 1, 83, 128, 2);
-  if (RemoteData._amp_break != old_amp_break)
-    tft.drawFloat(RemoteData._amp_break / 10.0, 1, 83, 144, 2);
-
-  tft.setTextPadding(38); // xx,xx (font2)
-  if (VescMeasuredValues.tachometerAbs != VescOldValues.tachometerAbs)
-    tft.drawFloat(VescMeasuredValues.tachometerAbs * ratio_TachoDist, 2, 10, 95, 2);
-
-  tft.setTextPadding(42); // xxx (font4)
-  if (VescMeasuredValues.v_in != VescOldValues.v_in)
-    tft.drawFloat(VescMeasuredValues.v_in, 1, 77, 100, 4);
-  if (VescMeasuredValues.current_motor != VescOldValues.current_motor)
-    tft.drawCentreNumber(VescMeasuredValues.current_motor, 22, 51, 4);
-  if (VescMeasuredValues.duty_now != VescOldValues.duty_now)
-    tft.drawCentreNumber(VescMeasuredValues.duty_now, 68, 51, 4);
-  float ampH = VescMeasuredValues.amp_hours - VescMeasuredValues.amp_hours_charged;
-  float ampHold = VescOldValues.amp_hours - VescOldValues.amp_hours_charged;
-  tft.setTextPadding(62); // xx,xx (font4)
-  if (ampH != ampHold)
-    tft.drawFloat(ampH, 2, 6, 134, 4);
-
-  tft.setTextPadding(24); // xxx (font2)
-  uint32_t _ridetime = (millis() - ridetime) / 1000;
-  tft.drawRightNumber((_ridetime / 60), 35, 112, 2); // m
-  tft.setTextPadding(16);                            // xx (font2)
-  tft.drawNumber(_ridetime % 60, 42, 112, 2);        // s
+  tft.initNumberSlot(&voltSlot, 126, 100, 4, 4, 1); // xx,x (font4)
+  tft.initNumberSlot(&motorSlot, 43, 51, 4, 3, 0);  // xxx (font4) A
+  tft.initNumberSlot(&dutySlot, 89, 51, 4, 3, 0);   // xxx (font4) %
+  tft.initNumberSlot(&rangeSlot, 69, 134, 4, 5, 1); // xxx,x (font4) remaining km
 }
 
-// Return is an RGB value.
-uint16_t gradientRYG(uint8_t value) {
-  // From green to yellow G stays at 0xFF and R goes from 0x00 to 0xFF
-  // Everything over yellow has R = 0xFF
-  if (value < 128) {
-    return 0xF800 + ((value * 2) << 3);
-  } else {
-    return 0x7E0 + (((255 - value) >> 2) << 11);
+// Paint one chunk of the main screen and remember its values, a field with more
+// than TFTchunk pixels to paint stays the stage until it is done
+// Returns the next stage, 0 when all fields are done
+uint8_t drawValues(uint8_t stage) {
+  switch (stage) {
+  case 1:
+    // Slots only redraw the digits that changed, so no need to compare with the old values
+    tft.setTextColor(RemoteData.cruise ? TFT_GREEN : TFT_WHITE, TFT_BLACK);
+    if (!tft.paintSlotNumber(&speedSlot, VescMeasuredValues.rpm * ratio_RpmSpeed, TFTchunk))
+      return stage;
+    break;
+  case 2:
+    battery = meter.soc(); // sag compensated, the bar doesn't drop under load
+    if (!fillBattery(battery))
+      return stage;
+    break;
+  case 3:
+    tft.setTextSize(1);
+    tft.setTextColor(TFT_WHITE, TFT_BLACK);
+    tft.setTextPadding(30); // xx,x (font2)
+    if (RemoteData._amp_fwd != old_amp_fwd)
+      tft.drawFloat(RemoteData._amp_fwd / 2.0, 1, 83, 128, 2);
+    old_amp_fwd = RemoteData._amp_fwd;
+    break;
+  case 4:
+    if (RemoteData._amp_break != old_amp_break)
+      tft.drawFloat(RemoteData._amp_break / 10.0, 1, 83, 144, 2);
+    old_amp_break = RemoteData._amp_break;
+    break;
+  case 5:
+    tft.setTextPadding(38); // xx,xx (font2)
+    if (VescMeasuredValues.tachometerAbs != old_tachometerAbs)
+      tft.drawFloat(VescMeasuredValues.tachometerAbs * ratio_TachoDist, 2, 10, 95, 2);
+    old_tachometerAbs = VescMeasuredValues.tachometerAbs;
+    break;
+  case 6:
+    if (!tft.paintSlotNumber(&voltSlot, VescMeasuredValues.v_in, TFTchunk)) // 0.1V
+      return stage;
+    break;
+  case 7:
+    if (!tft.paintSlotNumber(&motorSlot, VescMeasuredValues.current_motor / 100, TFTchunk)) // A
+      return stage;
+    break;
+  case 8:
+    if (!tft.paintSlotNumber(&dutySlot, VescMeasuredValues.duty_now / 10, TFTchunk)) // %
+      return stage;
+    break;
+  case 9: {
+    uint16_t range = meter.range(); // once, min() would run its divisions twice
+    if (!tft.paintSlotNumber(&rangeSlot, min(range, 9999), TFTchunk)) // 0.1km, downhill shows the most
+      return stage;
+  } break;
+  default: {
+    tft.setTextPadding(24); // xxx (font2)
+    uint32_t _ridetime = (millis() - ridetime) / 1000;
+    tft.drawRightNumber((_ridetime / 60), 35, 112, 2); // m
+    tft.setTextPadding(16);                            // xx (font2)
+    tft.drawNumber(_ridetime % 60, 42, 112, 2);        // s
   }
+    return 0;
+  }
+  return stage + 1;
 }
 
 void drawBattery(uint16_t color) {
@@ -367,73 +675,99 @@ void drawBattery(uint16_t color) {
   tft.drawRect(94, 1, 33, 95, color);
 }
 
-void fillBattery(uint8_t value) {
-  uint8_t line = 95 - (value / 2.8);
-  if (line != lastBatLine) {
-    lastBatLine = line;
-    tft.fillRect(96, 3, 29, 91, TFT_BLACK); // Overwrite all previous
-    if (value > 0) {
-      if (!batteryNorm)
-        drawBattery(TFT_WHITE);
-      while (line <= 93) { // last line
-        int16_t color_input;
-        color_input = map(line, 3, 94, 255, 0);
-        // drawFastHLine(x, y, w, color)
-        tft.drawFastHLine(96, line, 29, gradientRYG(color_input));
-        if (value < 25) {
-          drawBattery(TFT_RED); // below 10% warning
-          batteryNorm = false;
-        }
-        line++;
-      }
-    } else {
-      drawBattery(TFT_YELLOW);
-      batteryNorm = false;
-    }
+// Only the lines between the old and the new level are painted, batChunk of them per call
+// Returns true when the bar shows value
+bool fillBattery(uint8_t value) {
+  uint16_t outline = TFT_WHITE;
+  if (value == 0)
+    outline = TFT_YELLOW;
+  else if (value < 25)
+    outline = TFT_RED; // below 10% warning
+  if (outline != batteryOutline) {
+    batteryOutline = outline;
+    drawBattery(outline);
+  }
+
+  uint8_t line = 95 - (value * 5 + 13) / 14; // 95 - value / 2.8, rounded up like the float version
+  if (line > batEmpty)
+    line = batEmpty;
+  uint8_t target = line;
+  if (line + batChunk < lastBatLine)
+    line = lastBatLine - batChunk;
+  else if (line > lastBatLine + batChunk)
+    line = lastBatLine + batChunk;
+  if (line < lastBatLine) {
+    // Rising: one window for all new lines, each line gets its colour from the table
+    tft.setAddrWindow(96, line, 124, lastBatLine - 1);
+    for (uint8_t l = line; l < lastBatLine; l++)
+      tft.pushColor(pgm_read_word(&batGradient[l - batTop]), 29);
+  } else if (line > lastBatLine) {
+    // Falling: blank the lines that are no longer filled
+    tft.fillRect(96, lastBatLine, 29, line - lastBatLine, TFT_BLACK);
   }
+  lastBatLine = line;
+  return line == target;
 }
 
 // Enter Settings Mode. Exit only over reset.
+// The stick leaving the centre is an event: without button it selects the row, with button it changes the value.
+// Held with button the value repeats, faster the longer it is held. Only the rows an event changed are redrawn.
 void settingsMenu() {
-  drawSettings();
-  drawSettingValues(0);
   int8_t currentSetting = 0; // 0=save // 1=deadband // 2=amp_fwd_max // 3=amp_break_max // 4=amp_fwd_min // 5=amp_break_min // 6=maxvolt
-  bool ok;
-  bool triggerStick;
-  uint16_t stick;
+  int8_t stickDir = 0;       // 1 = up, -1 = down, 0 = centre
+  uint8_t repeats = 0;
+  uint16_t stepDelay = 0;
+  uint32_t stepTime = 0;
+  drawSettings();
+  drawSettingValues(currentSetting);
   while (1) {
-    DEB_cruise.update();
-    ok = !DEB_cruise.read();
-    stick = analogRead(PIN_POTI_THR);
-    // some movement has to be done to triggerStick
-    // when button is pressed and stick moved change value.
-    // without button change menu
-    if (stick > 712 && !triggerStick) { // mid 512
-      if (ok) {
-        changeSettings(true, currentSetting);
-        triggerStick = true;
-      } else {
-        currentSetting++;
-        triggerStick = true;
+    buttons.update();
+    bool ok = buttons.read(PIN_BTN_CRUISE);
+    uint16_t stick = analogRead(PIN_POTI_THR);
+    uint32_t now = millis();
+    int8_t event = 0;
+
+    if (stickDir == 0) {
+      if (stick > 712) // mid 512
+        stickDir = 1;
+      else if (stick < 312)
+        stickDir = -1;
+      if (stickDir) {
+        event = stickDir;
+        repeats = 0;
+        stepDelay = menuRepeatDelay;
+        stepTime = now;
       }
-    } else if (stick < 312 && !triggerStick) {
-      if (ok) {
-        changeSettings(false, currentSetting);
-        triggerStick = true;
-      } else {
-        currentSetting--;
-        triggerStick = true;
-      }
-    } else if (stick < 612 && stick > 412 && triggerStick) { // 100 difference so it won't jitter
-      // if (ok)
-      //   changeSettings(false, currentSetting);
-      triggerStick = false;
+    } else if (stick < 612 && stick > 412) { // 100 difference so it won't jitter
+      stickDir = 0;
+    } else if (ok && currentSetting != 0 && now - stepTime >= stepDelay) {
+      // Hold to repeat
+      event = stickDir;
+      if (repeats < 40)
+        repeats++;
+      stepDelay = menuRepeatStart >> (repeats / 5);
+      if (stepDelay < menuRepeatMin)
+        stepDelay = menuRepeatMin;
+      stepTime = now;
+    }
+    if (!event)
+      continue;
+
+    if (ok) {
+      changeSettings(event > 0, currentSetting);
+      if (currentSetting == 0)
+        drawSettingValues(currentSetting); // saved or discarded, every colour may change
+      else
+        drawSettingValue(currentSetting, true);
+    } else {
+      drawSettingValue(currentSetting, false);
+      currentSetting += event;
+      if (currentSetting > 6)
+        currentSetting = 0;
+      if (currentSetting < 0)
+        currentSetting = 6;
+      drawSettingValue(currentSetting, true);
     }
-    if (currentSetting > 6)
-      currentSetting = 0;
-    if (currentSetting < 0)
-      currentSetting = 6;
-    drawSettingValues(currentSetting);
   }
 }
 
@@ -444,90 +778,109 @@ void changeSettings(bool up, uint16_t currentS) {
     // up ? saveSettings() : discardSettings();
     break;
   case 1:
-    up ? RemoteData._deadband++ : RemoteData._deadband--;
+    stepSetting(settings.deadband, offsetof(settingsStruct, deadband), up);
     break;
   case 2:
-    up ? amp_fwd_max++ : amp_fwd_max--;
+    stepSetting(settings.amp_fwd_max, offsetof(settingsStruct, amp_fwd_max), up);
     break;
   case 3:
-    up ? amp_break_max++ : amp_break_max--;
+    stepSetting(settings.amp_break_max, offsetof(settingsStruct, amp_break_max), up);
     break;
   case 4:
-    up ? amp_fwd_min++ : amp_fwd_min--;
+    stepSetting(settings.amp_fwd_min, offsetof(settingsStruct, amp_fwd_min), up);
     break;
   case 5:
-    up ? amp_break_min++ : amp_break_min--;
+    stepSetting(settings.amp_break_min, offsetof(settingsStruct, amp_break_min), up);
     break;
   case 6:
-    up ? maxvolt++ : maxvolt--;
+    stepSetting(settings.maxvolt, offsetof(settingsStruct, maxvolt), up);
     break;
   }
 }
 
+// One step of the setting at offset, it stays inside the menu limits
+void stepSetting(uint8_t &value, uint8_t offset, bool up) {
+  if (up && value < pgm_read_byte((const uint8_t *)&settingsMax + offset))
+    value++;
+  if (!up && value > pgm_read_byte((const uint8_t *)&settingsMin + offset))
+    value--;
+}
+
+// Every setting into its menu limits
+void clampSettings() {
+  for (uint8_t i = 0; i < sizeof(settings); i++) {
+    uint8_t *value = (uint8_t *)&settings + i;
+    *value = constrain(*value, pgm_read_byte((const uint8_t *)&settingsMin + i), pgm_read_byte((const uint8_t *)&settingsMax + i));
+  }
+}
+
 void drawSettings() {
   tft.setTextSize(1); // no scaling
   tft.fillScreen(TFT_BLACK);
   tft.setTextColor(TFT_YELLOW, TFT_BLACK);
-  tft.drawCentreString("SETTINGS", 64, 5, 4); // Font 4
+  drawText(PSTR("SETTINGS"), 64, 5, 4, alignCentre); // Font 4
 
   tft.setTextColor(TFT_WHITE, TFT_BLACK);
-  tft.drawString("Deadband", 5, 35, 2);
-  tft.drawString("FWD max", 5, 55, 2);
-  tft.drawRightString("A", 120, 55, 2);
-  tft.drawString("Break max", 5, 75, 2);
-  tft.drawRightString("A", 120, 75, 2);
-  tft.drawString("FWD min", 5, 95, 2);
-  tft.drawRightString("A", 120, 95, 2);
-  tft.drawString("Break min", 5, 115, 2);
-  tft.drawRightString("A", 120, 115, 2);
-  tft.drawString("Max Volt", 5, 135, 2);
+  drawText(PSTR("Deadband"), 5, 35, 2, alignLeft);
+  drawText(PSTR("FWD max"), 5, 55, 2, alignLeft);
+  drawText(PSTR("A"), 120, 55, 2, alignRight);
+  drawText(PSTR("Break max"), 5, 75, 2, alignLeft);
+  drawText(PSTR("A"), 120, 75, 2, alignRight);
+  drawText(PSTR("FWD min"), 5, 95, 2, alignLeft);
+  drawText(PSTR("A"), 120, 95, 2, alignRight);
+  drawText(PSTR("Break min"), 5, 115, 2, alignLeft);
+  drawText(PSTR("A"), 120, 115, 2, alignRight);
+  drawText(PSTR("Max Volt"), 5, 135, 2, alignLeft);
 }
 
 // Write Values, green when saved, red when new, current marked with white background
 void drawSettingValues(uint16_t currentS) {
-  uint8_t eeBuffer;
-  tft.setTextPadding(24); // for 255
-  EEPROM.get(eeDeadband, eeBuffer);
-  tft.setTextColor(RemoteData._deadband == eeBuffer ? TFT_GREEN : TFT_RED, currentS == 1 ? TFT_LIGHTGREY : TFT_BLACK);
-  tft.drawNumber(RemoteData._deadband, 85, 35, 2);
-
-  tft.setTextPadding(38); // for 127,5
-  EEPROM.get(eeFwdMax, eeBuffer);
-  tft.setTextColor(amp_fwd_max == eeBuffer ? TFT_GREEN : TFT_RED, currentS == 2 ? TFT_LIGHTGREY : TFT_BLACK);
-  tft.drawFloat(amp_fwd_max / 2.0, 1, 85, 55, 2);
-
-  EEPROM.get(eeFwdMin, eeBuffer);
-  tft.setTextColor(amp_fwd_min == eeBuffer ? TFT_GREEN : TFT_RED, currentS == 4 ? TFT_LIGHTGREY : TFT_BLACK);
-  tft.drawFloat(amp_fwd_min / 2.0, 1, 85, 95, 2);
-
-  tft.setTextPadding(30); // for 25,5
-  EEPROM.get(eeBreakMax, eeBuffer);
-  tft.setTextColor(amp_break_max == eeBuffer ? TFT_GREEN : TFT_RED, currentS == 3 ? TFT_LIGHTGREY : TFT_BLACK);
-  tft.drawFloat(amp_break_max / 10.0, 1, 85, 75, 2);
-
-  EEPROM.get(eeBreakMin, eeBuffer);
-  tft.setTextColor(amp_break_min == eeBuffer ? TFT_GREEN : TFT_RED, currentS == 5 ? TFT_LIGHTGREY : TFT_BLACK);
-  tft.drawFloat(amp_break_min / 10.0, 1, 85, 115, 2);
-
-  EEPROM.get(eeMaxVolt, eeBuffer);
-  tft.setTextColor(maxvolt == eeBuffer ? TFT_GREEN : TFT_RED, currentS == 6 ? TFT_LIGHTGREY : TFT_BLACK);
-  tft.drawNumber(maxvolt / 5.0, 85, 135, 2);
+  for (uint8_t row = 1; row <= 6; row++)
+    drawSettingValue(row, row == currentS);
+}
+
+// Write one Value, row as in settingsMenu(), row 0 has no value
+void drawSettingValue(uint8_t row, bool selected) {
+  uint16_t bg = selected ? TFT_LIGHTGREY : TFT_BLACK;
+  switch (row) {
+  case 1:
+    tft.setTextPadding(24); // for 255
+    tft.setTextColor(settingsStore.changed(offsetof(settingsStruct, deadband)) ? TFT_RED : TFT_GREEN, bg);
+    tft.drawNumber(settings.deadband, 85, 35, 2);
+    break;
+  case 2:
+    tft.setTextPadding(38); // for 127,5
+    tft.setTextColor(settingsStore.changed(offsetof(settingsStruct, amp_fwd_max)) ? TFT_RED : TFT_GREEN, bg);
+    tft.drawFloat(settings.amp_fwd_max / 2.0, 1, 85, 55, 2);
+    break;
+  case 3:
+    tft.setTextPadding(30); // for 25,5
+    tft.setTextColor(settingsStore.changed(offsetof(settingsStruct, amp_break_max)) ? TFT_RED : TFT_GREEN, bg);
+    tft.drawFloat(settings.amp_break_max / 10.0, 1, 85, 75, 2);
+    break;
+  case 4:
+    tft.setTextPadding(38); // for 127,5
+    tft.setTextColor(settingsStore.changed(offsetof(settingsStruct, amp_fwd_min)) ? TFT_RED : TFT_GREEN, bg);
+    tft.drawFloat(settings.amp_fwd_min / 2.0, 1, 85, 95, 2);
+    break;
+  case 5:
+    tft.setTextPadding(30); // for 25,5
+    tft.setTextColor(settingsStore.changed(offsetof(settingsStruct, amp_break_min)) ? TFT_RED : TFT_GREEN, bg);
+    tft.drawFloat(settings.amp_break_min / 10.0, 1, 85, 115, 2);
+    break;
+  case 6:
+    tft.setTextPadding(30); // for 51
+    tft.setTextColor(settingsStore.changed(offsetof(settingsStruct, maxvolt)) ? TFT_RED : TFT_GREEN, bg);
+    tft.drawNumber(settings.maxvolt / 5.0, 85, 135, 2);
+    break;
+  }
 }
 
+// Only writes a new record if something changed, into the next wear levelling slot
 void saveSettings() {
-  EEPROM.update(eeDeadband, RemoteData._deadband);
-  EEPROM.update(eeFwdMax, amp_fwd_max);
-  EEPROM.update(eeBreakMax, amp_break_max);
-  EEPROM.update(eeFwdMin, amp_fwd_min);
-  EEPROM.update(eeBreakMin, amp_break_min);
-  EEPROM.update(eeMaxVolt, maxvolt);
+  settingsStore.save();
 }
 
 void discardSettings() {
-  EEPROM.get(eeDeadband, RemoteData._deadband);
-  EEPROM.get(eeFwdMax, amp_fwd_max);
-  EEPROM.get(eeBreakMax, amp_break_max);
-  EEPROM.get(eeFwdMin, amp_fwd_min);
-  EEPROM.get(eeBreakMin, amp_break_min);
-  EEPROM.get(eeMaxVolt, maxvolt);
+  settingsStore.revert();
 }
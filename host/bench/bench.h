@@ -0,0 +1,39 @@
+/*
+  bench.h - the timing loop of the host benchmarks
+
+  BENCH(name, iterations) { ... } runs the body the given number of times
+  and prints the host time per iteration. The numbers only compare one
+  variant with another on the same machine, the AVR cycles are not modelled.
+  benchKeep() keeps the compiler from dropping a result, benchLastNs holds
+  the time per iteration of the last BENCH for derived numbers.
+*/
+
+#ifndef HOST_BENCH_H
+#define HOST_BENCH_H
+
+#include <chrono>
+#include <stdio.h>
+
+static double benchLastNs;
+
+template <typename T> inline void benchKeep(const T &value)
+{
+    asm volatile("" : : "g"(&value) : "memory");
+}
+
+struct BenchRun {
+    BenchRun(const char *name, long iterations) : name(name), iterations(iterations), i(0), start(std::chrono::steady_clock::now()) {}
+    ~BenchRun()
+    {
+        double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        benchLastNs = ns / iterations;
+        printf("%-40s %10.1f ns\n", name, benchLastNs);
+    }
+    const char *name;
+    long iterations, i;
+    std::chrono::steady_clock::time_point start;
+};
+
+#define BENCH(label, count) for (BenchRun run(label, count); run.i < run.iterations; run.i++)
+
+#endif
@@ -0,0 +1,78 @@
+// colorutils array functions on a strip of 1024 pixels, scalar against the SSE2 and AVX2 kernels, in Mpixel/s
+
+#include <FastLED.h>
+#include <colorutils_simd.h>
+
+#include "bench.h"
+
+static const uint16_t count = 1024;
+static const long frames = 20000;
+
+static CRGB leds[count], other[count], dest[count];
+
+static void report()
+{
+    printf("%-40s %10.1f Mpixel/s\n", "", count / benchLastNs * 1000);
+}
+
+static void run(uint8_t level, const char *levelName)
+{
+    char name[40];
+
+    set_simd_level(level);
+    snprintf(name, sizeof(name), "%s nscale8", levelName);
+    BENCH(name, frames)
+    {
+        nscale8(leds, count, 250 + run.i % 5);
+        benchKeep(leds);
+    }
+    report();
+    snprintf(name, sizeof(name), "%s fadeToBlackBy", levelName);
+    BENCH(name, frames)
+    {
+        fadeToBlackBy(leds, count, 1 + run.i % 5);
+        benchKeep(leds);
+    }
+    report();
+    snprintf(name, sizeof(name), "%s nblend", levelName);
+    BENCH(name, frames)
+    {
+        nblend(leds, other, count, 1 + run.i % 200);
+        benchKeep(leds);
+    }
+    report();
+    snprintf(name, sizeof(name), "%s blend", levelName);
+    BENCH(name, frames)
+    {
+        blend(leds, other, dest, count, 1 + run.i % 200);
+        benchKeep(dest);
+    }
+    report();
+    snprintf(name, sizeof(name), "%s fill_gradient_RGB", levelName);
+    BENCH(name, frames)
+    {
+        fill_gradient_RGB(leds, count, CRGB(run.i, 20, 200), CRGB(10, run.i >> 3, 0));
+        benchKeep(leds);
+    }
+    report();
+    snprintf(name, sizeof(name), "%s blur1d", levelName);
+    BENCH(name, frames)
+    {
+        blur1d(leds, count, 64 + run.i % 64);
+        benchKeep(leds);
+    }
+    report();
+}
+
+int main()
+{
+    for (uint16_t i = 0; i < count; i++) {
+        other[i] = CHSV(i, 255, 255);
+        leds[i] = CRGB(i, i * 7, i * 13);
+    }
+    run(SIMD_SCALAR, "scalar");
+    run(SIMD_SSE2, "SSE2");
+    if (simd_supported() >= SIMD_AVX2)
+        run(SIMD_AVX2, "AVX2");
+    return 0;
+}
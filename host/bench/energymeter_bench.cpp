@@ -0,0 +1,67 @@
+// Cost of one EnergyMeter update per telemetry frame, by the work the frame does, and of the values the TX paints
+
+#include <Arduino.h>
+#include <EnergyMeter.h>
+
+#include "bench.h"
+
+static const long frames = 1000000; // the energy of the meter, 1e-5 Wh in 32 bit, stays in range
+
+static EnergyMeter meter;
+static uint32_t ah, tacho;
+
+static void start()
+{
+    meter = EnergyMeter();
+    meter.battery(300, 420, 500);
+    meter.distance(250000);
+    meter.resistance(150);
+    meter.consumption(200);
+    meter.update(400, 0, 0, 0, 0);
+    ah = tacho = 0;
+}
+
+int main()
+{
+    uint32_t sum = 0;
+
+    // Riding at a steady current, no resistance estimate, no segment closes
+    start();
+    BENCH("update, steady", frames)
+    {
+        meter.update(395 - (run.i & 1), 1500 + (run.i & 7), ah += 4, 0, tacho += 10);
+    }
+    benchKeep(meter);
+
+    // Every frame a 10A current step, a resistance estimate with its division
+    start();
+    BENCH("update, current step", frames)
+    {
+        meter.update(run.i & 1 ? 380 : 395, run.i & 1 ? 2500 : 1500, ah += 4, 0, tacho += 10);
+    }
+    benchKeep(meter);
+
+    // Every frame closes a segment of the Wh/km window
+    start();
+    BENCH("update, segment closes", frames)
+    {
+        meter.update(395, 1500, ah += 4, 0, tacho += 25000);
+    }
+    benchKeep(meter);
+
+    // With the values the TX paints
+    start();
+    BENCH("update + soc", frames)
+    {
+        meter.update(395 - (run.i & 7), 1500, ah += 4, 0, tacho += 10);
+        sum += meter.soc();
+    }
+    start();
+    BENCH("update + whKm + range", frames)
+    {
+        meter.update(395, 1500, ah += 4, 0, tacho += 25000);
+        sum += meter.whKm() + meter.range();
+    }
+    benchKeep(sum);
+    return 0;
+}
@@ -0,0 +1,53 @@
+// Cost of scaled Font 2 and RLE Font 4 glyphs: one address window per glyph against the per pixel path
+//
+// The per pixel path is still used for transparent text. With a background
+// fillRect() added it costs what opaque scaled text did before. Address
+// windows are counted from the CASET commands on the bus (DC low).
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <TFT_ST7735.h>
+
+#include "bench.h"
+
+static TFT_ST7735 tft;
+static unsigned long windows;
+
+static uint8_t countWindows(uint8_t b)
+{
+    if (!(PORTB & _BV(1)) && b == ST7735_CASET) windows++; // DC is pin 9, PB1
+    return 0xFF;
+}
+
+static void glyphs(const char *name, int font, uint8_t size, bool block)
+{
+    const long count = 2000;
+    unsigned long bytes = hostSpiBytes;
+    int x = 0;
+
+    windows = 0;
+    tft.setTextSize(size);
+    tft.setTextColor(TFT_WHITE, block ? TFT_BLACK : TFT_WHITE);
+    BENCH(name, count)
+    {
+        int w = tft.drawChar('0' + run.i % 10, x, 10, font);
+        if (!block) tft.fillRect(x, 10, w, tft.fontHeight(font) * size, TFT_BLACK);
+        x = x + w > 100 ? 0 : x + w;
+    }
+    printf("%-40s %10.1f SPI bytes, %5.1f windows, %5.1f ns per source row\n", "", (hostSpiBytes - bytes) / (double)count,
+           windows / (double)count, benchLastNs / tft.fontHeight(font));
+}
+
+int main()
+{
+    hostReset();
+    tft.init();
+    tft.setRotation(0);
+    hostSpiHook = countWindows;
+
+    glyphs("font 2 size 2, per pixel", 2, 2, false);
+    glyphs("font 2 size 2, one window", 2, 2, true);
+    glyphs("font 4 size 2, per pixel", 4, 2, false);
+    glyphs("font 4 size 2, one window", 4, 2, true);
+    return 0;
+}
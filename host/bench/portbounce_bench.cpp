@@ -0,0 +1,55 @@
+// Cost of debouncing the two TX buttons: one PortBounce against two Bounce2 instances
+//
+// The host time says little about the AVR, where digitalRead() with its pin
+// table lookups in flash and millis() with its interrupt lock are the
+// expensive parts. So the calls of both per update are counted as well.
+
+#include <Arduino.h>
+#include <Bounce2.h>
+#include <PortBounce.h>
+
+#include "bench.h"
+
+static void calls(unsigned long startUs, unsigned long startReads, long updates)
+{
+    printf("%-40s %10.2f millis() %5.2f digitalRead() per update\n", "", (micros() - startUs - 1) / (double)updates,
+           (hostPinReads - startReads) / (double)updates);
+}
+
+int main()
+{
+    const long updates = 1000000;
+    PortBounce buttons;
+    Bounce cruise, settings;
+    unsigned long us, reads;
+
+    hostReset();
+    hostTickPerCall = 1; // every millis() call moves the clock by 1us, so the clock counts them
+    buttons.attach(&PIND, _BV(2) | _BV(3), _BV(3));
+    cruise.attach(2);
+    cruise.interval(5);
+    settings.attach(3);
+    settings.interval(5);
+
+    us = micros();
+    reads = hostPinReads;
+    BENCH("PortBounce, 2 buttons", updates)
+    {
+        hostAdvance(99);
+        hostSetPin(2, run.i >> 8 & 1);
+        benchKeep(buttons.update());
+    }
+    calls(us + updates * 99, reads, updates);
+
+    us = micros();
+    reads = hostPinReads;
+    BENCH("Bounce2, 2 buttons", updates)
+    {
+        hostAdvance(99);
+        hostSetPin(2, run.i >> 8 & 1);
+        benchKeep(cruise.update());
+        benchKeep(settings.update());
+    }
+    calls(us + updates * 99, reads, updates);
+    return 0;
+}
@@ -0,0 +1,81 @@
+// Cost of the TX speed and number readouts: padded drawRightNumber()/drawFloat() against number slots
+//
+// The SPI bytes are what the ST7735 has to receive, at the 4MHz SPI clock of the
+// TX (8MHz, SPI2X) one byte takes 2us, so they are the AVR cost of a redraw.
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <TFT_ST7735.h>
+
+#include "bench.h"
+
+static TFT_ST7735 tft;
+
+// A ride of speeds in km/h, accelerating, cruising with noise and braking
+static long speed(long i)
+{
+    long t = i % 600;
+    if (t < 150) return t * 40 / 150;
+    if (t < 450) return 38 + (t * 7919 % 5) - 2;
+    return (600 - t) * 40 / 150;
+}
+
+static void report(const char *name, long updates, unsigned long bytes)
+{
+    printf("%-40s %10.1f SPI bytes, %8.1f us at 4MHz\n", name, (double)bytes / updates, bytes * 2.0 / updates);
+}
+
+int main()
+{
+    const long updates = 6000;
+    numberslot slot;
+    unsigned long bytes;
+
+    hostReset();
+    tft.init();
+    tft.setRotation(0);
+    tft.fillScreen(TFT_BLACK);
+    tft.setTextColor(TFT_WHITE, TFT_BLACK);
+
+    // Speed, font 4 at size 2, old code redraws the padded field when the value changes
+    tft.setTextSize(2);
+    tft.setTextPadding(56);
+    long last = -1;
+    bytes = hostSpiBytes;
+    BENCH("speed drawRightNumber, padded", updates)
+    {
+        long v = speed(run.i);
+        if (v != last) tft.drawRightNumber(v, 62, 2, 4);
+        last = v;
+    }
+    report("speed drawRightNumber, padded", updates, hostSpiBytes - bytes);
+
+    tft.setTextPadding(0);
+    tft.initNumberSlot(&slot, 62, 2, 4, 2, 0);
+    bytes = hostSpiBytes;
+    BENCH("speed drawSlotNumber", updates)
+    {
+        tft.drawSlotNumber(&slot, speed(run.i));
+    }
+    report("speed drawSlotNumber", updates, hostSpiBytes - bytes);
+
+    // Amp hours, font 4 with two decimals, counting up by 0.01Ah
+    tft.setTextSize(1);
+    tft.setTextPadding(62);
+    bytes = hostSpiBytes;
+    BENCH("amp hours drawFloat, padded", updates)
+    {
+        tft.drawFloat(run.i / 100.0, 2, 6, 134, 4);
+    }
+    report("amp hours drawFloat, padded", updates, hostSpiBytes - bytes);
+
+    tft.setTextPadding(0);
+    tft.initNumberSlot(&slot, 69, 134, 4, 5, 2);
+    bytes = hostSpiBytes;
+    BENCH("amp hours drawSlotNumber", updates)
+    {
+        tft.drawSlotNumber(&slot, run.i);
+    }
+    report("amp hours drawSlotNumber", updates, hostSpiBytes - bytes);
+    return 0;
+}
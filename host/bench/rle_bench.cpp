@@ -0,0 +1,54 @@
+// Cost of the RLE glyphs of Font 4, 6, 7 and 8, opaque and transparent, at size 1 and 2
+//
+// hostCpuHz is the 8MHz of the TX with the SPI2X clock of the TFT, so the
+// clock moves 2us per SPI byte and the us per glyph are the bus time on the
+// AVR. The host ns show the decoder itself.
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <TFT_ST7735.h>
+
+#include "bench.h"
+
+static TFT_ST7735 tft;
+
+static void glyphs(const char *name, int font, uint8_t size, bool opaque)
+{
+    const long count = 500;
+    unsigned long bytes = hostSpiBytes;
+    uint32_t start = micros();
+    int x = 0;
+
+    tft.setTextSize(size);
+    tft.setTextColor(TFT_WHITE, opaque ? TFT_BLACK : TFT_WHITE);
+    BENCH(name, count)
+    {
+        int w = tft.drawChar('0' + run.i % 10, x, 0, font);
+        x = x + w > 60 ? 0 : x + w;
+    }
+    printf("%-40s %10.1f SPI bytes, %8.1f us on the bus\n", "", (hostSpiBytes - bytes) / (double)count,
+           (micros() - start) / (double)count);
+}
+
+int main()
+{
+    static const int fonts[] = {4, 6, 7, 8};
+    char name[40];
+
+    hostReset();
+    tft.init();
+    tft.setRotation(0);
+    hostCpuHz = 8000000;
+
+    for (int font : fonts) {
+        snprintf(name, sizeof(name), "font %d size 1, opaque", font);
+        glyphs(name, font, 1, true);
+        snprintf(name, sizeof(name), "font %d size 1, transparent", font);
+        glyphs(name, font, 1, false);
+        snprintf(name, sizeof(name), "font %d size 2, opaque", font);
+        glyphs(name, font, 2, true);
+        snprintf(name, sizeof(name), "font %d size 2, transparent", font);
+        glyphs(name, font, 2, false);
+    }
+    return 0;
+}
@@ -0,0 +1,174 @@
+// Radio send latency of the TX sketch while it paints the display and logs to the card
+//
+// The whole sketch runs against the ST7735 and nRF24L01 models and a card
+// directory. The clock moves with the SPI bytes at the 8MHz of the TX, the
+// ADC conversions, the radio air time and SD.hostBlockUs per card block.
+// The CPU time of the sketch itself is not modelled, so the loop times are
+// the bus and wait share, a lower bound of the real ones.
+//
+// The log the TX wrote is read back at the end: the loop_max and vesc_age it
+// recorded for each phase have to show the same worst loop, so the fields
+// a rider's log holds can be read against the numbers here.
+
+#include <Arduino.h>
+#include <SD.h>
+#include <SPI.h>
+#include <SDLog.h>
+#include <local_datatypes.h>
+
+#include "NRF24Model.h"
+#include "ST7735Model.h"
+
+void setup();
+void loop();
+
+static ST7735Model panel(7, 9); // TFT_CS, TFT_DC of User_Setup.h
+static NRF24Model radio(5, 4);  // CSN, CE of the TX
+static bldcMeasure vesc;
+extern SDLog logger;
+
+// Telemetry of a ride, changing every 100ms like the VESC values of the RX
+static void ride(uint32_t ms)
+{
+    long t = ms / 100;
+    vesc.v_in = 400 - t / 50;
+    vesc.current_in = 500 + (t * 7919 % 3000);
+    vesc.current_motor = vesc.current_in * 2;
+    vesc.rpm = 6000 + (t * 104729 % 20000);
+    vesc.duty_now = 300 + t % 500;
+    vesc.amp_hours = t * 3;
+    vesc.tachometerAbs = t * 9;
+    radio.ack(&vesc, sizeof(vesc));
+}
+
+struct Phase {
+    const char *name;
+    unsigned long startMs, endMs;
+    uint32_t loops, worstUs, sendGapUs;
+    uint64_t totalUs;
+};
+
+static Phase run(const char *name, uint32_t ms)
+{
+    Phase p = {name, millis(), millis() + ms, 0, 0, 0, 0};
+    uint32_t end = p.endMs;
+
+    radio.maxGapUs = 0;
+    while (millis() < end) {
+        ride(millis());
+        uint32_t start = micros();
+        loop();
+        uint32_t us = micros() - start;
+        p.loops++;
+        p.totalUs += us;
+        if (us > p.worstUs) p.worstUs = us;
+    }
+    p.sendGapUs = radio.maxGapUs;
+    return p;
+}
+
+static void report(const Phase &p)
+{
+    printf("%-32s %6lu loops, mean %6.2f ms, worst %6.2f ms, worst send gap %6.2f ms\n", p.name, (unsigned long)p.loops,
+           p.totalUs / 1000.0 / p.loops, p.worstUs / 1000.0, p.sendGapUs / 1000.0);
+}
+
+// Only here, its <fcntl.h> defines O_CREAT and the other open flags of SD.h as macros
+#include "logreader.h"
+
+// Worst loop_max and vesc_age the TX logged during each phase
+// Event dumps of a log: a dump covers back to the previous event, or the ring was full and dropped older samples
+struct DumpStats {
+    uint64_t dump;
+    uint32_t dumps, full, ticks, firstMs, lastMs, eventMs;
+    uint32_t fullTicksMin, fullMsMin, fullMsMax;
+};
+
+static void closeDump(DumpStats *d, uint32_t ticks)
+{
+    if (!d->dumps) return;
+    if (d->firstMs > d->eventMs + 2 * 20) { // 20 ms tickPeriod, the ring dropped samples since the previous event
+        d->full++;
+        d->fullTicksMin = min(d->fullTicksMin, ticks);
+        d->fullMsMin = min(d->fullMsMin, d->lastMs - d->firstMs);
+        d->fullMsMax = max(d->fullMsMax, d->lastMs - d->firstMs);
+    }
+    d->eventMs = d->lastMs;
+}
+
+static void reportLog(const char *path, const Phase (&phases)[3])
+{
+    logReader reader;
+    const uint8_t *payload;
+    double loopMax[3] = {0}, ageMax[3] = {0};
+    DumpStats d = {0, 0, 0, 0, 0, 0, 0, ~0u, ~0u, 0};
+    uint32_t dumpTicks = 0;
+
+    if (logOpen(&reader, path)) return;
+    reader.ticks = true;
+    int loop = logFieldIndex(&reader, "loop_max"), age = logFieldIndex(&reader, "vesc_age");
+    while (loop >= 0 && age >= 0 && (payload = logNextSample(&reader))) {
+        if (reader.isTick) {
+            if (reader.eventFrames != d.dump) {
+                closeDump(&d, dumpTicks);
+                d.dump = reader.eventFrames;
+                d.dumps++;
+                d.firstMs = reader.ms;
+                dumpTicks = 0;
+            }
+            d.lastMs = reader.ms;
+            dumpTicks++;
+            d.ticks++;
+            continue;
+        }
+        for (int i = 0; i < 3; i++) {
+            if (reader.ms < phases[i].startMs || reader.ms >= phases[i].endMs) continue;
+            loopMax[i] = max(loopMax[i], logValue(&reader.fields[loop], payload));
+            ageMax[i] = max(ageMax[i], logValue(&reader.fields[age], payload));
+        }
+    }
+    closeDump(&d, dumpTicks);
+    for (int i = 0; i < 3; i++)
+        printf("%-32s logged loop_max worst %4.0f ms, vesc_age worst %4.0f ms\n", phases[i].name, loopMax[i], ageMax[i]);
+    printf("%lu event dumps, %lu samples, %lu reach back to the previous event\n", (unsigned long)d.dumps,
+           (unsigned long)d.ticks, (unsigned long)(d.dumps - d.full));
+    if (d.full)
+        printf("%lu with a full ring: %lu samples at least, %lu..%lu ms before the event\n", (unsigned long)d.full,
+               (unsigned long)d.fullTicksMin, (unsigned long)d.fullMsMin, (unsigned long)d.fullMsMax);
+    printf("%lu samples logged, %lu bad frames\n", (unsigned long)(reader.samples - d.ticks), (unsigned long)reader.badFrames);
+    logClose(&reader);
+}
+
+int main()
+{
+    char dir[] = "/tmp/txloopXXXXXX";
+
+    hostReset();
+    if (!mkdtemp(dir)) return 1;
+    SD.hostRoot(dir);
+    hostCpuHz = 8000000;
+    SD.hostBlockUs = 1500; // 515 bytes at 4MHz and about 0.5ms of card busy time
+    hostSetPin(3, LOW);    // settings button released, it is active high
+    hostSetAnalog(A3, 700); // throttle
+    hostSetAnalog(A2, 512);
+    hostSetAnalog(A1, 512);
+    hostSetAnalog(A0, 800);
+    panel.attach();
+    radio.attach();
+    ride(0);
+
+    setup();
+    run("wait before send", 6000);
+    Phase phases[3];
+    report(phases[0] = run("riding, link up", 60000));
+    radio.lost = true;
+    report(phases[1] = run("link lost", 5000));
+    radio.lost = false;
+    SD.hostBlockUs = 20000; // a card that takes its time for wear levelling
+    report(phases[2] = run("riding, slow card", 30000));
+    printf("%lu packets sent\n", radio.packets);
+
+    logger.sync();
+    reportLog(SD.hostPath("LOG000.BIN"), phases);
+    return 0;
+}
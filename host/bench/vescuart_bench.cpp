@@ -0,0 +1,32 @@
+// Cost of sending a command frame and of decoding a COMM_GET_VALUES reply
+
+#include <Arduino.h>
+#include <VescUart.h>
+#include <buffer.h>
+
+#include "bench.h"
+
+int main()
+{
+    uint8_t payload[64];
+    bldcMeasure values;
+    int32_t ind = 0;
+
+    hostReset();
+    payload[ind++] = COMM_GET_VALUES;
+    for (; ind < 56; ind++)
+        payload[ind] = ind;
+
+    BENCH("VescUartSetCurrentMilli", 1000000)
+    {
+        VescUartSetCurrentMilli(run.i);
+        Serial.hostClear();
+    }
+    BENCH("ProcessReadPacket", 1000000)
+    {
+        payload[20] = run.i;
+        ProcessReadPacket(payload, values, 56);
+        benchKeep(values);
+    }
+    return 0;
+}
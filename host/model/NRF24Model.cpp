@@ -0,0 +1,143 @@
+// Please read NRF24Model.h for information about what the model understands
+
+#include <SPI.h>
+#include <nRF24L01.h>
+
+#include "NRF24Model.h"
+
+static NRF24Model *attached;
+static HostSpiHook nextSpi;
+static HostPinHook nextPin;
+
+NRF24Model::NRF24Model(uint8_t csnPin, uint8_t cePin)
+    : airUs(500)
+    , lost(false)
+    , packets(0)
+    , maxGapUs(0)
+    , csnPin(csnPin)
+    , cePin(cePin)
+    , selected(false)
+    , command(-1)
+    , count(0)
+    , txCount(0)
+    , rxCount(0)
+    , ackLen(0)
+    , onAir(false)
+    , airStart(0)
+    , airEnd(0)
+    , lastStart(0)
+{
+    memset(regs, 0, sizeof(regs));
+    regs[NRF_CONFIG] = 0x08;
+    regs[SETUP_RETR] = 0x03;
+}
+
+void NRF24Model::attach()
+{
+    attached = this;
+    nextSpi = hostSpiHook;
+    nextPin = hostPinHook;
+    hostSpiHook = spiHook;
+    hostPinHook = pinHook;
+}
+
+void NRF24Model::ack(const void *data, uint8_t len)
+{
+    ackLen = min(len, sizeof(ackData));
+    memcpy(ackData, data, ackLen);
+}
+
+// MISO is driven by the selected device only, the others float high
+uint8_t NRF24Model::spiHook(uint8_t b)
+{
+    uint8_t in = nextSpi ? nextSpi(b) : 0xFF;
+    return attached ? in & attached->transfer(b) : in;
+}
+
+void NRF24Model::pinHook(uint8_t pin, uint8_t level)
+{
+    if (attached) attached->pin(pin, level);
+    if (nextPin) nextPin(pin, level);
+}
+
+void NRF24Model::pin(uint8_t pin, uint8_t level)
+{
+    poll();
+    if (pin == csnPin) {
+        if (level && selected && command == R_RX_PAYLOAD && rxCount) {
+            // The payload read leaves the FIFO with the end of the command
+            rxCount--;
+            memmove(rx[0], rx[1], sizeof(rx[0]) * 2);
+            memmove(rxLen, rxLen + 1, 2);
+        }
+        selected = !level;
+        command = -1;
+        count = 0;
+    }
+    if (pin == cePin && level && txCount && !onAir) {
+        onAir = true;
+        airStart = micros();
+        airEnd = airStart + (lost ? ((regs[SETUP_RETR] & 0x0F) + 1) * (airUs + 250UL * (regs[SETUP_RETR] >> 4)) : airUs);
+        if (packets && airStart - lastStart > maxGapUs) maxGapUs = airStart - lastStart;
+        lastStart = airStart;
+        packets++;
+    }
+}
+
+// Finishes the packet on air once the clock has passed its end
+void NRF24Model::poll()
+{
+    if (!onAir || (int32_t)(micros() - airEnd) < 0) return;
+    onAir = false;
+    if (lost) {
+        regs[NRF_STATUS] |= _BV(MAX_RT);
+        return;
+    }
+    txCount--;
+    regs[NRF_STATUS] |= _BV(TX_DS);
+    if (ackLen && rxCount < 3) {
+        memcpy(rx[rxCount], ackData, ackLen);
+        rxLen[rxCount++] = ackLen;
+        regs[NRF_STATUS] |= _BV(RX_DR);
+    }
+}
+
+uint8_t NRF24Model::status()
+{
+    return (regs[NRF_STATUS] & 0x70) | (rxCount ? 0 : 0x07 << RX_P_NO) | (txCount >= 3 ? _BV(TX_FULL) : 0);
+}
+
+uint8_t NRF24Model::transfer(uint8_t b)
+{
+    if (!selected) return 0xFF;
+    poll();
+
+    if (command < 0) {
+        command = b;
+        if (command == FLUSH_TX) txCount = 0;
+        if (command == FLUSH_RX) rxCount = 0;
+        if (command == W_TX_PAYLOAD || command == W_TX_PAYLOAD_NO_ACK) {
+            if (txCount < 3) txCount++;
+        }
+        return status();
+    }
+
+    uint8_t n = count++;
+    if (command < W_REGISTER) {
+        uint8_t reg = command & REGISTER_MASK;
+        if (reg == NRF_STATUS) return status();
+        if (reg == FIFO_STATUS) return (rxCount ? 0 : _BV(RX_EMPTY)) | (txCount ? 0 : _BV(TX_EMPTY));
+        return regs[reg];
+    }
+    if (command < ACTIVATE) {
+        uint8_t reg = command & REGISTER_MASK;
+        if (reg == NRF_STATUS)
+            regs[reg] &= ~(b & 0x70); // write 1 to clear
+        else if (!n)
+            regs[reg] = b; // the first byte of an address is enough here
+        return 0;
+    }
+    if (command == R_RX_PL_WID) return rxCount ? rxLen[0] : 0;
+    if (command == R_RX_PAYLOAD) return rxCount && n < rxLen[0] ? rx[0][n] : 0;
+    return 0;
+}
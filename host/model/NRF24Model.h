@@ -0,0 +1,54 @@
+/*
+  NRF24Model.h - an nRF24L01+ in PTX mode on the SPI bus of the host build
+
+  The model listens on hostSpiHook while its CSN pin is low and takes the
+  CSN and CE edges from hostPinHook. Both hooks are passed on to what was
+  attached before, so attach() the radio after the other models of the bus.
+
+  The registers keep what is written, STATUS and FIFO_STATUS follow the
+  FIFOs. A payload goes on air when CE rises and takes airUs until TX_DS,
+  then the ack payload set with ack() is in the RX FIFO. With lost set no
+  ack comes back and MAX_RT follows after the retries of SETUP_RETR.
+*/
+
+#ifndef NRF24Model_h
+#define NRF24Model_h
+
+#include <Arduino.h>
+
+class NRF24Model
+{
+ public:
+    NRF24Model(uint8_t csnPin, uint8_t cePin);
+
+    // Takes hostSpiHook and hostPinHook, passes both on to the hooks before
+    void attach();
+    // Payload of every ack, up to 32 bytes, 0 for an empty ack
+    void ack(const void *data, uint8_t len);
+
+    uint32_t airUs;        // [us] payload, ack and turnarounds, 500 us at 2 Mbit/s
+    bool lost;             // no ack, every packet ends with MAX_RT
+    unsigned long packets; // payloads put on air
+    uint32_t maxGapUs;     // [us] longest time from one payload on air to the next
+
+ private:
+    static uint8_t spiHook(uint8_t b);
+    static void pinHook(uint8_t pin, uint8_t level);
+    uint8_t transfer(uint8_t b);
+    void pin(uint8_t pin, uint8_t level);
+    void poll();
+    uint8_t status();
+
+    uint8_t csnPin, cePin;
+    bool selected;
+    int16_t command; // -1 before the command byte
+    uint8_t count;   // data bytes of the command
+    uint8_t regs[32];
+    uint8_t txCount;
+    uint8_t rx[3][32], rxLen[3], rxCount;
+    uint8_t ackData[32], ackLen;
+    bool onAir;
+    uint32_t airStart, airEnd, lastStart;
+};
+
+#endif
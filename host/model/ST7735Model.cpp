@@ -0,0 +1,155 @@
+// Please read ST7735Model.h for information about what the model understands
+
+#include <SPI.h>
+#include <TFT_ST7735.h>
+
+#include "ST7735Model.h"
+
+static ST7735Model *attached;
+
+ST7735Model::ST7735Model(uint8_t csPin, uint8_t dcPin)
+    : csPort(portOutputRegister(digitalPinToPort(csPin)))
+    , dcPort(portOutputRegister(digitalPinToPort(dcPin)))
+    , csMask(digitalPinToBitMask(csPin))
+    , dcMask(digitalPinToBitMask(dcPin))
+    , madctl(0)
+{
+    clear();
+}
+
+void ST7735Model::attach()
+{
+    attached = this;
+    hostSpiHook = hook;
+}
+
+void ST7735Model::clear(uint16_t color)
+{
+    for (int i = 0; i < width * height; i++)
+        ram[i] = color;
+    commands = data = windows = 0;
+    command = 0;
+    argCount = 0;
+    pixelHigh = false;
+    xs = ys = cx = cy = 0;
+    xe = width - 1;
+    ye = height - 1;
+}
+
+uint8_t ST7735Model::hook(uint8_t b)
+{
+    if (attached) attached->receive(b);
+    return 0xFF;
+}
+
+void ST7735Model::receive(uint8_t b)
+{
+    if (*csPort & csMask) return; // not selected
+
+    if (!(*dcPort & dcMask)) {
+        commands++;
+        command = b;
+        argCount = 0;
+        pixelHigh = false;
+        if (command == ST7735_CASET) windows++;
+        if (command == ST7735_RAMWR) {
+            cx = xs;
+            cy = ys;
+        }
+        return;
+    }
+
+    data++;
+    switch (command) {
+    case ST7735_CASET:
+    case ST7735_RASET:
+        if (argCount < 4) args[argCount++] = b;
+        if (argCount == 4) {
+            uint16_t s = args[0] << 8 | args[1], e = args[2] << 8 | args[3];
+            if (command == ST7735_CASET) {
+                xs = s;
+                xe = e;
+            } else {
+                ys = s;
+                ye = e;
+            }
+        }
+        break;
+    case ST7735_MADCTL:
+        madctl = b;
+        break;
+    case ST7735_RAMWR:
+        if (!pixelHigh) {
+            high = b;
+            pixelHigh = true;
+        } else {
+            store(high << 8 | b);
+            pixelHigh = false;
+        }
+        break;
+    }
+}
+
+// Writes at the address counter and moves it on, left to right and top to bottom
+// in the window like the controller, wrapping to the start after the last pixel
+void ST7735Model::store(uint16_t color)
+{
+    int x = cx, y = cy;
+
+    if (madctl & MADCTL_MV) {
+        int t = x;
+        x = y;
+        y = t;
+    }
+    // MX and MY are set for rotation 0 of a black tab, that is the upright image
+    if (!(madctl & MADCTL_MX)) x = width - 1 - x;
+    if (!(madctl & MADCTL_MY)) y = height - 1 - y;
+    if (x >= 0 && x < width && y >= 0 && y < height) ram[y * width + x] = color;
+
+    if (cx++ >= xe) {
+        cx = xs;
+        if (cy++ >= ye) cy = ys;
+    }
+}
+
+uint16_t ST7735Model::pixel(int x, int y)
+{
+    return ram[y * width + x];
+}
+
+bool ST7735Model::writePPM(const char *path)
+{
+    FILE *f = fopen(path, "wb");
+    if (!f) return false;
+    fprintf(f, "P6\n%d %d\n255\n", width, height);
+    for (int i = 0; i < width * height; i++) {
+        uint16_t c = ram[i];
+        uint8_t rgb[3] = {(uint8_t)((c >> 11) * 255 / 31), (uint8_t)(((c >> 5) & 0x3F) * 255 / 63), (uint8_t)((c & 0x1F) * 255 / 31)};
+        fwrite(rgb, 1, 3, f);
+    }
+    return !fclose(f);
+}
+
+long ST7735Model::comparePPM(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    int w, h, maxval;
+    long diff = 0;
+
+    if (!f) return -1;
+    if (fscanf(f, "P6 %d %d %d", &w, &h, &maxval) != 3 || w != width || h != height || fgetc(f) == EOF) {
+        fclose(f);
+        return -1;
+    }
+    for (int i = 0; i < width * height; i++) {
+        uint8_t rgb[3];
+        if (fread(rgb, 1, 3, f) != 3) {
+            fclose(f);
+            return -1;
+        }
+        uint16_t c = ram[i];
+        if (rgb[0] != (c >> 11) * 255 / 31 || rgb[1] != ((c >> 5) & 0x3F) * 255 / 63 || rgb[2] != (c & 0x1F) * 255 / 31) diff++;
+    }
+    fclose(f);
+    return diff;
+}
@@ -0,0 +1,58 @@
+/*
+  ST7735Model.h - a 128x160 ST7735 on the SPI bus of the host build
+
+  The model listens on hostSpiHook while its chip select is low. The DC pin
+  tells commands from data like on the real controller, both are read from the
+  AVR port registers the TFT_ST7735 FastPin code writes.
+
+  Understood are CASET, RASET, RAMWR and MADCTL, the other commands and their
+  data are only counted. Pixels are kept as RGB565 in panel order. image()
+  and writePPM() give the panel as the remote holds it: a black tab panel
+  with rotation 0 is upright.
+*/
+
+#ifndef ST7735Model_h
+#define ST7735Model_h
+
+#include <Arduino.h>
+
+class ST7735Model
+{
+ public:
+    static const int width = 128, height = 160;
+
+    // Chip select and data/command pins, the TFT_CS and TFT_DC of User_Setup.h
+    ST7735Model(uint8_t csPin, uint8_t dcPin);
+
+    // Takes hostSpiHook, a later attach() of another model replaces this one
+    void attach();
+    // Fills the memory with a colour and clears the counters
+    void clear(uint16_t color = 0);
+
+    // Pixel of the upright image
+    uint16_t pixel(int x, int y);
+    // Writes the upright image as binary PPM, returns false if the file can not be written
+    bool writePPM(const char *path);
+    // Compares with a PPM written by writePPM(), returns the number of different pixels
+    // or -1 if the file can not be read
+    long comparePPM(const char *path);
+
+    unsigned long commands, data, windows; // bytes with DC low and high, CASET commands
+
+ private:
+    static uint8_t hook(uint8_t b);
+    void receive(uint8_t b);
+    void store(uint16_t color);
+
+    volatile uint8_t *csPort, *dcPort;
+    uint8_t csMask, dcMask;
+    uint8_t command, argCount;
+    uint8_t args[4];
+    uint8_t madctl;
+    uint16_t xs, xe, ys, ye, cx, cy;
+    bool pixelHigh;
+    uint8_t high;
+    uint16_t ram[width * height];
+};
+
+#endif
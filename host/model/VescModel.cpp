@@ -0,0 +1,54 @@
+// Please read VescModel.h for information about the model
+
+#include "VescModel.h"
+
+VescModel::VescModel()
+    : commands(0)
+    , badFrames(0)
+    , answers(0)
+    , maxGapMs(0)
+    , modelMs(0)
+    , lastMs(0)
+{
+    vescInit(&vesc);
+    vesc.onCommand = onCommand;
+    vesc.ctx = this;
+}
+
+void VescModel::attach(HardwareSerial &port)
+{
+    port.hostAttach(this);
+    modelMs = millis();
+    vesc.lastCmd = modelMs;
+}
+
+void VescModel::update()
+{
+    uint32_t now = millis();
+    while ((int32_t)(now - modelMs) > 0)
+        vescStep(&vesc, ++modelMs);
+}
+
+void VescModel::hostWrite(HardwareSerial *port, const uint8_t *data, size_t len)
+{
+    update();
+    vescReceive(&vesc, data, len, modelMs);
+    if (vesc.answerLen) {
+        port->hostReceive(vesc.answer, vesc.answerLen);
+        vesc.answerLen = 0;
+        answers++;
+    }
+}
+
+void VescModel::onCommand(void *ctx, uint32_t ms, const char *, double, bool valid)
+{
+    VescModel *m = (VescModel *)ctx;
+
+    if (!valid) {
+        m->badFrames++;
+        return;
+    }
+    if (m->commands && ms - m->lastMs > m->maxGapMs) m->maxGapMs = ms - m->lastMs;
+    m->lastMs = ms;
+    m->commands++;
+}
@@ -0,0 +1,44 @@
+/*
+  VescModel.h - a VESC on the host Serial
+
+  The motor, battery and protocol model of tools/vescmodel.h as a
+  HostSerialDevice: attach() it to a port and the frames the sketch or
+  VescUartControl write go into the model, the answers to COMM_GET_VALUES
+  come back on the wire time of the port. The model is moved on to millis()
+  with every write and with update(), so a test that only watches it calls
+  update() before reading vesc.
+*/
+
+#ifndef VescModel_h
+#define VescModel_h
+
+#include <Arduino.h>
+
+#include "vescmodel.h"
+
+class VescModel : public HostSerialDevice
+{
+ public:
+    VescModel();
+
+    // Answers on port from now on, the model starts at the current millis()
+    void attach(HardwareSerial &port);
+    // Moves the model on to millis()
+    void update();
+
+    void hostWrite(HardwareSerial *port, const uint8_t *data, size_t len);
+
+    vescModel vesc;          // state, battery and board, see vescmodel.h
+    unsigned long commands;  // valid commands, requests not counted
+    unsigned long badFrames; // bad CRC, unknown or short commands
+    unsigned long answers;   // COMM_GET_VALUES answered
+    uint32_t maxGapMs;       // [ms] longest time between two commands
+
+ private:
+    static void onCommand(void *ctx, uint32_t ms, const char *name, double value, bool valid);
+
+    uint32_t modelMs;
+    uint32_t lastMs;
+};
+
+#endif
@@ -0,0 +1,512 @@
+// Please read Arduino.h for information about the host side of the fake hardware
+
+#include <Arduino.h>
+#include <EEPROM.h>
+#include <SPI.h>
+#include <pins_arduino.h>
+
+static uint64_t clockUs;
+static uint32_t clockNs; // below 1 us, from the SPI bytes
+uint32_t hostTickPerCall;
+uint32_t hostCpuHz;
+unsigned long hostPinReads;
+HostPinHook hostPinHook;
+
+static uint8_t pinLevel[NUM_DIGITAL_PINS]; // input level
+static uint8_t pinOut[NUM_DIGITAL_PINS];   // last digitalWrite()
+static uint8_t pinModes[NUM_DIGITAL_PINS];
+static int analogIn[NUM_DIGITAL_PINS];
+static int analogOut[NUM_DIGITAL_PINS];
+
+volatile uint8_t PORTB, PORTC, PORTD;
+volatile uint8_t DDRB, DDRC, DDRD;
+volatile uint8_t PINB, PINC, PIND;
+volatile uint8_t SPCR;
+HostSPSR SPSR = {_BV(SPIF)};
+HostSPDR SPDR;
+static uint8_t spdrIn;
+
+HostSpiHook hostSpiHook;
+unsigned long hostSpiBytes;
+unsigned long hostSpiTransactions;
+
+HardwareSerial Serial;
+SPIClass SPI;
+EEPROMClass EEPROM;
+
+// time
+
+unsigned long millis()
+{
+    clockUs += hostTickPerCall;
+    return clockUs / 1000;
+}
+
+unsigned long micros()
+{
+    clockUs += hostTickPerCall;
+    return clockUs;
+}
+
+void delay(unsigned long ms)
+{
+    clockUs += (uint64_t)ms * 1000;
+}
+
+void delayMicroseconds(unsigned int us)
+{
+    clockUs += us;
+}
+
+void hostAdvance(uint32_t us)
+{
+    clockUs += us;
+}
+
+// pins
+
+uint8_t digitalPinToPort(uint8_t pin)
+{
+    if (pin < 8) return PD;
+    if (pin < 14) return PB;
+    if (pin < 20) return PC;
+    return NOT_A_PIN;
+}
+
+uint8_t digitalPinToBitMask(uint8_t pin)
+{
+    if (pin < 8) return _BV(pin);
+    if (pin < 14) return _BV(pin - 8);
+    if (pin < 20) return _BV(pin - 14);
+    return 0;
+}
+
+volatile uint8_t *portOutputRegister(uint8_t port)
+{
+    return port == PB ? &PORTB : port == PC ? &PORTC : port == PD ? &PORTD : 0;
+}
+
+volatile uint8_t *portInputRegister(uint8_t port)
+{
+    return port == PB ? &PINB : port == PC ? &PINC : port == PD ? &PIND : 0;
+}
+
+volatile uint8_t *portModeRegister(uint8_t port)
+{
+    return port == PB ? &DDRB : port == PC ? &DDRC : port == PD ? &DDRD : 0;
+}
+
+static void setBit(volatile uint8_t *reg, uint8_t mask, bool on)
+{
+    if (!reg) return;
+    if (on)
+        *reg |= mask;
+    else
+        *reg &= ~mask;
+}
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+    if (pin >= NUM_DIGITAL_PINS) return;
+    pinModes[pin] = mode;
+    setBit(portModeRegister(digitalPinToPort(pin)), digitalPinToBitMask(pin), mode == OUTPUT);
+    if (mode == INPUT_PULLUP) setBit(portOutputRegister(digitalPinToPort(pin)), digitalPinToBitMask(pin), true);
+}
+
+void digitalWrite(uint8_t pin, uint8_t val)
+{
+    if (pin >= NUM_DIGITAL_PINS) return;
+    pinOut[pin] = val ? HIGH : LOW;
+    setBit(portOutputRegister(digitalPinToPort(pin)), digitalPinToBitMask(pin), val);
+    if (hostPinHook) hostPinHook(pin, pinOut[pin]);
+}
+
+int digitalRead(uint8_t pin)
+{
+    hostPinReads++;
+    if (pin >= NUM_DIGITAL_PINS) return LOW;
+    if (pinModes[pin] == OUTPUT) return pinOut[pin];
+    return pinLevel[pin];
+}
+
+int analogRead(uint8_t pin)
+{
+    if (hostCpuHz) clockUs += 104; // 13 ADC clocks at 125 kHz
+    if (pin < A0 && pin + A0 < NUM_DIGITAL_PINS) pin += A0; // analogRead(0) is A0
+    return pin < NUM_DIGITAL_PINS ? analogIn[pin] : 0;
+}
+
+void analogWrite(uint8_t pin, int val)
+{
+    if (pin < NUM_DIGITAL_PINS) analogOut[pin] = val;
+}
+
+void hostSetPin(uint8_t pin, uint8_t level)
+{
+    if (pin >= NUM_DIGITAL_PINS) return;
+    pinLevel[pin] = level ? HIGH : LOW;
+    setBit(portInputRegister(digitalPinToPort(pin)), digitalPinToBitMask(pin), level);
+}
+
+uint8_t hostGetPin(uint8_t pin)
+{
+    return pin < NUM_DIGITAL_PINS ? pinOut[pin] : LOW;
+}
+
+void hostSetAnalog(uint8_t pin, int value)
+{
+    if (pin < A0 && pin + A0 < NUM_DIGITAL_PINS) pin += A0;
+    if (pin < NUM_DIGITAL_PINS) analogIn[pin] = value;
+}
+
+int hostGetAnalogWrite(uint8_t pin)
+{
+    return pin < NUM_DIGITAL_PINS ? analogOut[pin] : 0;
+}
+
+uint8_t hostPinMode(uint8_t pin)
+{
+    return pin < NUM_DIGITAL_PINS ? pinModes[pin] : INPUT;
+}
+
+void hostReset()
+{
+    clockUs = 0;
+    clockNs = 0;
+    hostCpuHz = 0;
+    hostPinReads = 0;
+    hostTickPerCall = 0;
+    memset(pinLevel, HIGH, sizeof(pinLevel)); // inputs float high with the pull ups
+    memset(pinOut, LOW, sizeof(pinOut));
+    memset(pinModes, INPUT, sizeof(pinModes));
+    memset(analogIn, 0, sizeof(analogIn));
+    memset(analogOut, 0, sizeof(analogOut));
+    PORTB = PORTC = PORTD = 0;
+    DDRB = DDRC = DDRD = 0;
+    PINB = PINC = PIND = 0xFF;
+    SPCR = 0;
+    SPSR = 0;
+    hostSpiHook = 0;
+    hostPinHook = 0;
+    hostSpiBytes = 0;
+    hostSpiTransactions = 0;
+    Serial.hostClear();
+    Serial.hostAttach(0);
+    EEPROM.hostErase();
+}
+
+// math
+
+long map(long x, long in_min, long in_max, long out_min, long out_max)
+{
+    return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+static uint32_t randomState = 1;
+
+void randomSeed(unsigned long seed)
+{
+    if (seed) randomState = seed;
+}
+
+long random(long howbig)
+{
+    if (howbig == 0) return 0;
+    randomState = randomState * 1103515245 + 12345;
+    return (randomState >> 1) % howbig;
+}
+
+long random(long howsmall, long howbig)
+{
+    if (howsmall >= howbig) return howsmall;
+    return random(howbig - howsmall) + howsmall;
+}
+
+// avr-libc stdlib
+
+char *ultoa(unsigned long value, char *s, int radix)
+{
+    char digits[sizeof(value) * 8 + 1];
+    int n = 0;
+
+    if (radix < 2 || radix > 36) radix = 10;
+    do {
+        int d = value % radix;
+        digits[n++] = d < 10 ? '0' + d : 'a' + d - 10;
+        value /= radix;
+    } while (value);
+    for (int i = 0; i < n; i++)
+        s[i] = digits[n - 1 - i];
+    s[n] = 0;
+    return s;
+}
+
+char *ltoa(long value, char *s, int radix)
+{
+    if (value < 0 && radix == 10) {
+        s[0] = '-';
+        ultoa(-(unsigned long)value, s + 1, radix);
+        return s;
+    }
+    return ultoa(value, s, radix);
+}
+
+char *itoa(int value, char *s, int radix)
+{
+    return ltoa(value, s, radix);
+}
+
+char *utoa(unsigned int value, char *s, int radix)
+{
+    return ultoa(value, s, radix);
+}
+
+char *dtostrf(double value, signed char width, unsigned char prec, char *s)
+{
+    sprintf(s, "%*.*f", width, prec, value);
+    return s;
+}
+
+FILE *fdevopen(int (*put)(char, FILE *), int (*get)(FILE *))
+{
+    return stdout;
+}
+
+// SPI
+
+// Clock divider of SPCR and SPSR
+static uint8_t spiDivider()
+{
+    static const uint8_t div[4] = {4, 16, 64, 128};
+    return div[SPCR & 0x03] >> (SPSR & _BV(SPI2X));
+}
+
+HostSPDR &HostSPDR::operator=(uint8_t b)
+{
+    hostSpiBytes++;
+    if (hostCpuHz) {
+        clockNs += 8000000000ULL * spiDivider() / hostCpuHz;
+        clockUs += clockNs / 1000;
+        clockNs %= 1000;
+    }
+    spdrIn = hostSpiHook ? hostSpiHook(b) : 0xFF;
+    return *this;
+}
+
+HostSPDR::operator uint8_t() const
+{
+    return spdrIn;
+}
+
+// The registers for the fastest SPI clock not above settings.clock, like the AVR core
+void SPIClass::beginTransaction(SPISettings settings)
+{
+    uint32_t cpuHz = hostCpuHz ? hostCpuHz : 16000000;
+    uint8_t div = 0; // 2, 4, 8 .. 128
+
+    hostSpiTransactions++;
+    while (div < 6 && settings.clock < cpuHz / (2UL << div))
+        div++;
+    static const uint8_t spr[7] = {0, 0, 1, 1, 2, 2, 3};
+    SPCR = _BV(SPE) | _BV(MSTR) | (settings.bitOrder == LSBFIRST ? _BV(DORD) : 0) | (settings.dataMode & 0x0C) | spr[div];
+    SPSR = (SPSR & ~_BV(SPI2X)) | (div < 6 && !(div & 1) ? _BV(SPI2X) : 0);
+}
+
+uint8_t SPIClass::transfer(uint8_t data)
+{
+    SPDR = data;
+    return SPDR;
+}
+
+uint16_t SPIClass::transfer16(uint16_t data)
+{
+    uint16_t hi = transfer(data >> 8);
+    return (hi << 8) | transfer(data & 0xFF);
+}
+
+void SPIClass::transfer(void *buf, size_t count)
+{
+    uint8_t *p = (uint8_t *)buf;
+    for (size_t i = 0; i < count; i++)
+        p[i] = transfer(p[i]);
+}
+
+void SPIClass::setClockDivider(uint8_t div)
+{
+    SPCR = (SPCR & ~0x03) | (div & 0x03);
+    SPSR = (SPSR & ~_BV(SPI2X)) | ((div >> 2) & _BV(SPI2X));
+}
+
+// Print
+
+size_t Print::write(const uint8_t *buffer, size_t size)
+{
+    size_t n = 0;
+    while (size--) {
+        if (!write(*buffer++)) break;
+        n++;
+    }
+    return n;
+}
+
+size_t Print::print(const char str[]) { return write(str); }
+size_t Print::print(char c) { return write((uint8_t)c); }
+size_t Print::print(unsigned char b, int base) { return print((unsigned long)b, base); }
+size_t Print::print(int n, int base) { return print((long)n, base); }
+size_t Print::print(unsigned int n, int base) { return print((unsigned long)n, base); }
+
+size_t Print::print(long n, int base)
+{
+    if (base == 0) return write((uint8_t)n);
+    if (base == 10 && n < 0) return print('-') + printNumber(-(unsigned long)n, 10);
+    return printNumber(n, base);
+}
+
+size_t Print::print(unsigned long n, int base)
+{
+    if (base == 0) return write((uint8_t)n);
+    return printNumber(n, base);
+}
+
+size_t Print::print(double n, int digits) { return printFloat(n, digits); }
+
+size_t Print::println(void) { return write("\r\n"); }
+size_t Print::println(const char c[]) { return print(c) + println(); }
+size_t Print::println(char c) { return print(c) + println(); }
+size_t Print::println(unsigned char b, int base) { return print(b, base) + println(); }
+size_t Print::println(int num, int base) { return print(num, base) + println(); }
+size_t Print::println(unsigned int num, int base) { return print(num, base) + println(); }
+size_t Print::println(long num, int base) { return print(num, base) + println(); }
+size_t Print::println(unsigned long num, int base) { return print(num, base) + println(); }
+size_t Print::println(double num, int digits) { return print(num, digits) + println(); }
+
+size_t Print::printNumber(unsigned long n, uint8_t base)
+{
+    char buf[8 * sizeof(long) + 1];
+    char *str = &buf[sizeof(buf) - 1];
+
+    *str = '\0';
+    if (base < 2) base = 10;
+    do {
+        char c = n % base;
+        n /= base;
+        *--str = c < 10 ? c + '0' : c + 'A' - 10;
+    } while (n);
+    return write(str);
+}
+
+size_t Print::printFloat(double number, uint8_t digits)
+{
+    char buf[48];
+
+    if (isnan(number)) return print("nan");
+    if (isinf(number)) return print("inf");
+    if (number > 4294967040.0 || number < -4294967040.0) return print("ovf");
+    snprintf(buf, sizeof(buf), "%.*f", digits, number);
+    return print(buf);
+}
+
+// Stream
+
+size_t Stream::readBytes(uint8_t *buffer, size_t length)
+{
+    size_t n = 0;
+    while (n < length && available() > 0)
+        buffer[n++] = read();
+    return n;
+}
+
+// Serial
+
+HardwareSerial::HardwareSerial()
+    : device(0)
+    , baud(0)
+    , rxHead(0)
+    , rxCount(0)
+    , wireDue(0)
+    , wireHead(0)
+    , wireCount(0)
+    , overruns(0)
+    , outLen(0)
+{
+    out[0] = 0;
+}
+
+// Moves the bytes the clock has passed from the wire into the receive buffer
+void HardwareSerial::pump()
+{
+    uint32_t byteUs = baud ? 10000000UL / baud : 0; // start + 8 data + stop bit
+    uint64_t due = wireDue - (uint64_t)(wireCount ? wireCount - 1 : 0) * byteUs; // first byte on the wire
+
+    while (wireCount && due <= clockUs) {
+        if (rxCount < SERIAL_RX_BUFFER_SIZE) {
+            rx[(rxHead + rxCount) % SERIAL_RX_BUFFER_SIZE] = wire[wireHead];
+            rxCount++;
+        } else {
+            overruns++;
+        }
+        wireHead = (wireHead + 1) % SERIAL_WIRE_SIZE;
+        wireCount--;
+        due += byteUs;
+    }
+}
+
+int HardwareSerial::available()
+{
+    pump();
+    return rxCount;
+}
+
+int HardwareSerial::read()
+{
+    pump();
+    if (!rxCount) return -1;
+    uint8_t b = rx[rxHead];
+    rxHead = (rxHead + 1) % SERIAL_RX_BUFFER_SIZE;
+    rxCount--;
+    return b;
+}
+
+int HardwareSerial::peek()
+{
+    pump();
+    return rxCount ? rx[rxHead] : -1;
+}
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size)
+{
+    if (device) {
+        device->hostWrite(this, buffer, size);
+    } else {
+        for (size_t i = 0; i < size && outLen < sizeof(out) - 1; i++)
+            out[outLen++] = buffer[i];
+        out[outLen] = 0;
+    }
+    return size;
+}
+
+size_t HardwareSerial::hostReceive(const uint8_t *data, size_t len)
+{
+    uint32_t byteUs = baud ? 10000000UL / baud : 0;
+    size_t n = 0;
+
+    pump();
+    if (wireDue < clockUs) wireDue = clockUs;
+    for (; n < len && wireCount < SERIAL_WIRE_SIZE; n++) {
+        wire[(wireHead + wireCount) % SERIAL_WIRE_SIZE] = data[n];
+        wireCount++;
+        wireDue += byteUs;
+    }
+    pump();
+    return n;
+}
+
+void HardwareSerial::hostClear()
+{
+    rxHead = rxCount = 0;
+    wireHead = wireCount = 0;
+    wireDue = 0;
+    overruns = 0;
+    outLen = 0;
+    out[0] = 0;
+}
@@ -0,0 +1,132 @@
+/*
+  Arduino.h for the host build
+
+  Just enough of the Arduino core to compile the sketches and the libraries
+  with the host compiler. The hardware is replaced by state the tests can
+  read and set:
+
+          time        a virtual clock, millis() and micros() only move with
+                      delay(), hostAdvance() or hostTickPerCall
+          pins        digital levels and analog values per pin, the AVR port
+                      registers of avr/io.h follow digitalWrite()
+          Serial      see HardwareSerial.h, a device can be attached
+          SPI         see SPI.h, every byte goes to one hook and takes the
+                      time of the SPI clock if hostCpuHz is set
+
+  Call hostReset() at the start of a test to clear all of it.
+*/
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <type_traits>
+
+#include <avr/io.h>
+#include <avr/pgmspace.h>
+
+typedef uint8_t byte;
+typedef bool boolean;
+typedef unsigned int word;
+
+#define HIGH 0x1
+#define LOW 0x0
+
+#define INPUT 0x0
+#define OUTPUT 0x1
+#define INPUT_PULLUP 0x2
+
+#define LSBFIRST 0
+#define MSBFIRST 1
+
+#define PI 3.1415926535897932384626433832795
+
+#define A0 14
+#define A1 15
+#define A2 16
+#define A3 17
+#define A4 18
+#define A5 19
+#define A6 20
+#define A7 21
+#define NUM_DIGITAL_PINS 22
+
+// Functions instead of the macros of the AVR core, so the C++ headers of the host still compile
+template <typename A, typename B> inline typename std::common_type<A, B>::type min(const A &a, const B &b)
+{
+    return a < b ? a : b;
+}
+template <typename A, typename B> inline typename std::common_type<A, B>::type max(const A &a, const B &b)
+{
+    return a > b ? a : b;
+}
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#define sq(x) ((x) * (x))
+
+#define lowByte(w) ((uint8_t)((w) & 0xff))
+#define highByte(w) ((uint8_t)((w) >> 8))
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+#define bitWrite(value, bit, bitvalue) ((bitvalue) ? bitSet(value, bit) : bitClear(value, bit))
+#define bit(b) (1UL << (b))
+
+#define F(s) (s)
+#define interrupts()
+#define noInterrupts()
+#define yield()
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+void analogWrite(uint8_t pin, int val);
+
+// The port of a pin and its bit, see pins_arduino.h for the mapping
+uint8_t digitalPinToPort(uint8_t pin);
+uint8_t digitalPinToBitMask(uint8_t pin);
+volatile uint8_t *portOutputRegister(uint8_t port);
+volatile uint8_t *portInputRegister(uint8_t port);
+volatile uint8_t *portModeRegister(uint8_t port);
+
+long map(long x, long in_min, long in_max, long out_min, long out_max);
+long random(long max);
+long random(long min, long max);
+void randomSeed(unsigned long seed);
+
+// The avr-libc conversions of stdlib.h
+char *ltoa(long value, char *s, int radix);
+char *ultoa(unsigned long value, char *s, int radix);
+char *itoa(int value, char *s, int radix);
+char *utoa(unsigned int value, char *s, int radix);
+char *dtostrf(double value, signed char width, unsigned char prec, char *s);
+
+// printf() of the host already goes to stdout, printf.h of RF24 may call this
+FILE *fdevopen(int (*put)(char, FILE *), int (*get)(FILE *));
+
+// Host side of the fake hardware
+void hostReset();
+void hostAdvance(uint32_t us);                 // moves the clock
+extern uint32_t hostTickPerCall;               // [us] added by every millis()/micros(), for busy waits
+extern uint32_t hostCpuHz;                     // [Hz] with it SPI bytes and analogRead() take their time, 0: no time
+extern unsigned long hostPinReads;             // digitalRead() calls
+typedef void (*HostPinHook)(uint8_t pin, uint8_t level);
+extern HostPinHook hostPinHook;                // gets every digitalWrite(), e.g. chip selects of a model
+void hostSetPin(uint8_t pin, uint8_t level);   // level seen by digitalRead() and the PINx registers
+uint8_t hostGetPin(uint8_t pin);               // last digitalWrite()
+void hostSetAnalog(uint8_t pin, int value);    // 0..1023 for analogRead()
+int hostGetAnalogWrite(uint8_t pin);           // last analogWrite()
+uint8_t hostPinMode(uint8_t pin);
+
+#include "HardwareSerial.h"
+
+#endif
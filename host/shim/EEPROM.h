@@ -0,0 +1,57 @@
+/*
+  EEPROM.h for the host build, 1 kB like the ATmega328
+
+  Erased cells read 0xFF. Every cell counts its writes, update() only writes
+  a changed value like the AVR library, so tests can check the wear.
+*/
+
+#ifndef HOST_EEPROM_H
+#define HOST_EEPROM_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define E2END 0x3FF
+
+class EEPROMClass
+{
+ public:
+    EEPROMClass() { hostErase(); }
+    uint8_t read(int idx) { return mem[idx & E2END]; }
+    void write(int idx, uint8_t val)
+    {
+        mem[idx & E2END] = val;
+        writes[idx & E2END]++;
+    }
+    void update(int idx, uint8_t val)
+    {
+        if (read(idx) != val) write(idx, val);
+    }
+    uint16_t length() { return E2END + 1; }
+
+    template <typename T> T &get(int idx, T &t)
+    {
+        for (size_t i = 0; i < sizeof(T); i++)
+            ((uint8_t *)&t)[i] = read(idx + i);
+        return t;
+    }
+    template <typename T> const T &put(int idx, const T &t)
+    {
+        for (size_t i = 0; i < sizeof(T); i++)
+            update(idx + i, ((const uint8_t *)&t)[i]);
+        return t;
+    }
+
+    // Host side
+    void hostErase()
+    {
+        memset(mem, 0xFF, sizeof(mem));
+        memset(writes, 0, sizeof(writes));
+    }
+    uint8_t mem[E2END + 1];
+    unsigned long writes[E2END + 1];
+};
+
+extern EEPROMClass EEPROM;
+
+#endif
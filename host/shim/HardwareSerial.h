@@ -0,0 +1,73 @@
+/*
+  HardwareSerial.h for the host build
+
+  Serial keeps what the sketch writes and delivers what the host side puts
+  into its receive buffer. A device attached with hostAttach() gets every
+  written byte right away and answers with hostReceive(), e.g. a model of
+  the VESC. Without a device the written bytes collect in hostOutput().
+
+  Received bytes arrive on the wire time of the baud rate set with begin():
+  they move into the 64 byte receive buffer of the AVR core only when the
+  clock has passed them, and are lost (hostOverruns()) if the sketch lets the
+  buffer fill up.
+*/
+
+#ifndef HOST_HARDWARESERIAL_H
+#define HOST_HARDWARESERIAL_H
+
+#include "Stream.h"
+
+#define SERIAL_RX_BUFFER_SIZE 64 // like the AVR core, bytes beyond are lost
+#define SERIAL_WIRE_SIZE 1024    // bytes on their way
+
+class HardwareSerial;
+
+class HostSerialDevice
+{
+ public:
+    virtual ~HostSerialDevice() {}
+    // Bytes the sketch wrote, answer with port->hostReceive()
+    virtual void hostWrite(HardwareSerial *port, const uint8_t *data, size_t len) = 0;
+};
+
+class HardwareSerial : public Stream
+{
+ public:
+    HardwareSerial();
+    void begin(unsigned long baud) { this->baud = baud; }
+    void end() {}
+    int available();
+    int read();
+    int peek();
+    using Print::write;
+    size_t write(uint8_t b) { return write(&b, 1); }
+    size_t write(const uint8_t *buffer, size_t size);
+    operator bool() { return true; }
+
+    // Host side
+    void hostAttach(HostSerialDevice *device) { this->device = device; }
+    size_t hostReceive(const uint8_t *data, size_t len); // returns the bytes that fit on the wire
+    const char *hostOutput() { return out; }             // written bytes without a device, 0 terminated
+    size_t hostOutputLength() { return outLen; }
+    void hostClear();
+    unsigned long hostBaud() { return baud; }
+    unsigned long hostOverruns() { return overruns; }
+
+ private:
+    void pump();
+
+    HostSerialDevice *device;
+    unsigned long baud;
+    uint8_t rx[SERIAL_RX_BUFFER_SIZE];
+    uint8_t rxHead, rxCount;
+    uint8_t wire[SERIAL_WIRE_SIZE];
+    uint64_t wireDue; // [us] arrival of the last byte on the wire
+    uint16_t wireHead, wireCount;
+    unsigned long overruns;
+    char out[4096];
+    size_t outLen;
+};
+
+extern HardwareSerial Serial;
+
+#endif
@@ -0,0 +1,372 @@
+// Please read SD.h for information about the open modes of the host card
+
+#include <dirent.h>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+#include <SD.h>
+
+SDClass SD;
+
+static std::string root = ".";
+
+// The block range of a contiguous file on the virtual card
+struct HostExtent {
+    uint32_t first;
+    uint32_t last;
+    std::string path;
+};
+
+static std::vector<HostExtent> extents;
+static uint32_t nextBlock = 8192; // the blocks before are the FAT and the root directory
+static uint8_t cache[512];
+static Sd2Card card;
+static bool mounted;
+
+static HostExtent *findExtent(uint32_t block)
+{
+    for (size_t i = 0; i < extents.size(); i++)
+        if (block >= extents[i].first && block <= extents[i].last) return &extents[i];
+    return 0;
+}
+
+// A FAT or directory block read through the cache of SdVolume
+static void cacheOther()
+{
+    memset(cache, 0xCC, sizeof(cache));
+}
+
+// Writes count times the byte, or data, at block of the extent
+static bool writeExtent(const HostExtent *e, uint32_t block, const uint8_t *data, int byte, uint32_t count)
+{
+    FILE *fp = fopen(e->path.c_str(), "r+b");
+    uint8_t fillBlock[512];
+    bool ok = fp && !fseek(fp, (block - e->first) * 512L, SEEK_SET);
+
+    memset(fillBlock, byte, sizeof(fillBlock));
+    for (uint32_t i = 0; ok && i < count; i++)
+        ok = fwrite(data ? data : fillBlock, 1, 512, fp) == 512;
+    if (fp) fclose(fp);
+    return ok;
+}
+
+uint8_t Sd2Card::erase(uint32_t firstBlock, uint32_t lastBlock)
+{
+    HostExtent *e = findExtent(firstBlock);
+
+    if (!e || lastBlock < firstBlock || lastBlock > e->last) return false;
+    hostAdvance(SD.hostBlockUs); // the card erases on its own, only the command is on the bus
+    return writeExtent(e, firstBlock, 0, 0xFF, lastBlock - firstBlock + 1);
+}
+
+uint8_t Sd2Card::readBlock(uint32_t block, uint8_t *dst)
+{
+    HostExtent *e = findExtent(block);
+    FILE *fp = e ? fopen(e->path.c_str(), "rb") : 0;
+    bool ok = fp && !fseek(fp, (block - e->first) * 512L, SEEK_SET) && fread(dst, 1, 512, fp) == 512;
+
+    if (fp) fclose(fp);
+    hostAdvance(SD.hostBlockUs);
+    return ok;
+}
+
+uint8_t Sd2Card::writeBlock(uint32_t blockNumber, const uint8_t *src)
+{
+    HostExtent *e = findExtent(blockNumber);
+
+    if (!e) return false;
+    hostAdvance(SD.hostBlockUs);
+    SD.hostWritten += 512;
+    return writeExtent(e, blockNumber, src, 0, 1);
+}
+
+uint8_t *SdVolume::cacheClear()
+{
+    return mounted ? cache : 0;
+}
+
+uint8_t SdVolume::init(Sd2Card *dev)
+{
+    cacheOther(); // the boot sector
+    return dev == &card && mounted;
+}
+
+Sd2Card *SdVolume::sdCard()
+{
+    return mounted ? &card : 0;
+}
+
+SdFile::SdFile() : type(0), first(0), last(0) {}
+
+uint8_t SdFile::close()
+{
+    if (type == 2) cacheOther(); // the directory entry
+    type = 0;
+    return true;
+}
+
+uint8_t SdFile::contiguousRange(uint32_t *bgnBlock, uint32_t *endBlock)
+{
+    if (type != 2) return false;
+    *bgnBlock = first;
+    *endBlock = last;
+    return true;
+}
+
+// The new file keeps the old data of its blocks, like on the card
+uint8_t SdFile::createContiguous(SdFile *dirFile, const char *fileName, uint32_t size)
+{
+    struct stat st;
+    std::string path = SD.hostPath(fileName);
+    uint32_t blocks = (size + 511) / 512;
+
+    cacheOther(); // the FAT is searched for free clusters
+    hostAdvance(SD.hostBlockUs);
+    if (type || !dirFile || dirFile->type != 1 || !blocks || !stat(path.c_str(), &st)) return false;
+    if (SD.hostFreeRun && blocks > SD.hostFreeRun) return false;
+    FILE *fp = fopen(path.c_str(), "wb");
+    if (!fp) return false;
+    fclose(fp);
+
+    HostExtent e = {nextBlock, nextBlock + blocks - 1, path};
+    if (!writeExtent(&e, e.first, 0, 0x5A, blocks)) return false;
+    extents.push_back(e);
+    nextBlock += blocks;
+    first = e.first;
+    last = e.last;
+    type = 2;
+    return true;
+}
+
+uint8_t SdFile::openRoot(SdVolume *vol)
+{
+    if (type || !vol || !mounted) return false;
+    cacheOther();
+    type = 1;
+    return true;
+}
+
+struct HostFile {
+    int refs;
+    FILE *fp;
+    DIR *dir;
+    std::string path;
+    char name[13];
+    uint8_t mode;
+    uint32_t pos;
+};
+
+File::File() : f(0) {}
+
+File::File(const File &other) : f(other.f)
+{
+    if (f) f->refs++;
+}
+
+File &File::operator=(const File &other)
+{
+    if (other.f) other.f->refs++;
+    release();
+    f = other.f;
+    return *this;
+}
+
+File::~File()
+{
+    release();
+}
+
+// The host handle goes with the last copy of the File
+void File::release()
+{
+    if (f && !--f->refs) {
+        close();
+        delete f;
+    }
+    f = 0;
+}
+
+size_t File::write(const uint8_t *buf, size_t size)
+{
+    if (!f || !f->fp || !(f->mode & O_WRITE)) return 0;
+    if (f->mode & O_APPEND) f->pos = this->size(); // SdFile::write() seeks to the end first
+    fseek(f->fp, f->pos, SEEK_SET);
+    size_t n = fwrite(buf, 1, size, f->fp);
+    if (n) hostAdvance(((f->pos + n + 511) / 512 - f->pos / 512) * SD.hostBlockUs);
+    f->pos += n;
+    SD.hostWritten += n;
+    return n;
+}
+
+int File::read()
+{
+    uint8_t b;
+    return read(&b, 1) == 1 ? b : -1;
+}
+
+int File::read(void *buf, uint16_t nbyte)
+{
+    if (!f || !f->fp || !(f->mode & O_READ)) return -1;
+    fseek(f->fp, f->pos, SEEK_SET);
+    size_t n = fread(buf, 1, nbyte, f->fp);
+    f->pos += n;
+    return n;
+}
+
+int File::peek()
+{
+    uint32_t pos = position();
+    int b = read();
+    seek(pos);
+    return b;
+}
+
+int File::available()
+{
+    return f && f->fp ? size() - f->pos : 0;
+}
+
+void File::flush()
+{
+    if (!f || !f->fp) return;
+    fflush(f->fp);
+    hostAdvance(SD.hostBlockUs); // the directory entry
+}
+
+bool File::seek(uint32_t pos)
+{
+    if (!f || !f->fp || pos > size()) return false;
+    f->pos = pos;
+    return true;
+}
+
+uint32_t File::position()
+{
+    return f ? f->pos : 0;
+}
+
+uint32_t File::size()
+{
+    if (!f || !f->fp) return 0;
+    fflush(f->fp);
+    struct stat st;
+    return stat(f->path.c_str(), &st) ? 0 : st.st_size;
+}
+
+void File::close()
+{
+    if (!f) return;
+    if (f->fp) fclose(f->fp);
+    if (f->dir) closedir(f->dir);
+    f->fp = 0;
+    f->dir = 0;
+}
+
+File::operator bool()
+{
+    return f && (f->fp || f->dir);
+}
+
+char *File::name()
+{
+    return f ? f->name : 0;
+}
+
+bool File::isDirectory()
+{
+    return f && f->dir;
+}
+
+File File::openNextFile(uint8_t mode)
+{
+    struct dirent *e;
+
+    if (!f || !f->dir) return File();
+    while ((e = readdir(f->dir))) {
+        if (e->d_name[0] == '.') continue;
+        std::string path = f->path + "/" + e->d_name;
+        return SD.open(path.c_str() + root.size() + 1, mode);
+    }
+    return File();
+}
+
+void File::rewindDirectory()
+{
+    if (f && f->dir) rewinddir(f->dir);
+}
+
+bool SDClass::begin(uint8_t csPin)
+{
+    mounted = !hostFail;
+    return mounted;
+}
+
+File SDClass::open(const char *filepath, uint8_t mode)
+{
+    File file;
+    struct stat st;
+    std::string path = hostPath(filepath);
+    bool found = !stat(path.c_str(), &st);
+
+    hostCalls++;
+    if (found && S_ISDIR(st.st_mode)) {
+        DIR *dir = opendir(path.c_str());
+        if (!dir) return file;
+        file.f = new HostFile();
+        file.f->dir = dir;
+    } else {
+        if (!found && !(mode & O_CREAT)) return file;
+        if (found && (mode & O_CREAT) && (mode & O_EXCL)) return file;
+        FILE *fp = fopen(path.c_str(), found && !(mode & O_TRUNC) ? "r+b" : "w+b");
+        if (!fp) return file;
+        file.f = new HostFile();
+        file.f->fp = fp;
+    }
+    file.f->refs = 1;
+    file.f->path = path;
+    file.f->mode = mode;
+    const char *base = strrchr(filepath, '/');
+    strncpy(file.f->name, base ? base + 1 : filepath, 12);
+    file.f->name[12] = 0;
+    // SD.open() with FILE_WRITE starts at the end like the Arduino library
+    file.f->pos = (mode & O_WRITE) && (mode & O_APPEND) ? file.size() : 0;
+    return file;
+}
+
+bool SDClass::exists(const char *filepath)
+{
+    struct stat st;
+    hostCalls++;
+    return !stat(hostPath(filepath), &st);
+}
+
+bool SDClass::mkdir(const char *filepath)
+{
+    return !::mkdir(hostPath(filepath), 0777);
+}
+
+bool SDClass::remove(const char *filepath)
+{
+    return !unlink(hostPath(filepath));
+}
+
+bool SDClass::rmdir(const char *filepath)
+{
+    return !::rmdir(hostPath(filepath));
+}
+
+void SDClass::hostRoot(const char *dir)
+{
+    root = dir;
+}
+
+const char *SDClass::hostPath(const char *filepath)
+{
+    static std::string path;
+    while (*filepath == '/')
+        filepath++;
+    path = root + "/" + filepath;
+    return path.c_str();
+}
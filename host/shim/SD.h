@@ -0,0 +1,132 @@
+/*
+  SD.h for the host build
+
+  The card is a directory of the host, hostRoot() selects it. The open modes
+  and their effect are those of the Arduino SD library: FILE_WRITE contains
+  O_APPEND and with O_APPEND every write() goes to the end of the file, no
+  matter where seek() moved the position. Names are used as given, 8.3 upper
+  case like on the card.
+
+  Sd2Card, SdVolume and SdFile are the parts of the SdFat layer under SD.h
+  that raw block writes need. The card is virtual there: every file of
+  SdFile::createContiguous() gets its own range of block numbers, a new
+  file holds the old data of the card until it is erased, erased blocks
+  read as 0xFF. The FAT and directory work of SdFile goes through the one
+  block cache of SdVolume, like on the card.
+*/
+
+#ifndef HOST_SD_H
+#define HOST_SD_H
+
+#include <Arduino.h>
+#include <pins_arduino.h>
+#include <stdio.h>
+
+#if defined(O_READ) || defined(O_CREAT)
+#error "SD.h of the host build clashes with <fcntl.h>"
+#endif
+
+uint8_t const O_READ = 0x01;
+uint8_t const O_RDONLY = O_READ;
+uint8_t const O_WRITE = 0x02;
+uint8_t const O_WRONLY = O_WRITE;
+uint8_t const O_RDWR = (O_READ | O_WRITE);
+uint8_t const O_APPEND = 0x04;
+uint8_t const O_SYNC = 0x08;
+uint8_t const O_CREAT = 0x10;
+uint8_t const O_EXCL = 0x20;
+uint8_t const O_TRUNC = 0x40;
+
+#define FILE_READ O_READ
+#define FILE_WRITE (O_READ | O_WRITE | O_CREAT | O_APPEND)
+
+class Sd2Card
+{
+ public:
+    uint8_t erase(uint32_t firstBlock, uint32_t lastBlock);
+    uint8_t readBlock(uint32_t block, uint8_t *dst);
+    uint8_t writeBlock(uint32_t blockNumber, const uint8_t *src); // fails outside the files, that is the FAT on a card
+};
+
+class SdVolume
+{
+ public:
+    static uint8_t *cacheClear();
+    uint8_t init(Sd2Card *dev);
+    static Sd2Card *sdCard();
+};
+
+class SdFile
+{
+ public:
+    SdFile();
+    uint8_t close();
+    uint8_t contiguousRange(uint32_t *bgnBlock, uint32_t *endBlock);
+    uint8_t createContiguous(SdFile *dirFile, const char *fileName, uint32_t size);
+    uint8_t isOpen() const { return type != 0; }
+    uint8_t openRoot(SdVolume *vol);
+
+ private:
+    uint8_t type; // 0 closed, 1 root, 2 file
+    uint32_t first;
+    uint32_t last;
+};
+
+struct HostFile;
+
+class File : public Stream
+{
+ public:
+    File();
+    File(const File &f);
+    File &operator=(const File &f);
+    ~File();
+
+    using Print::write;
+    size_t write(uint8_t b) { return write(&b, 1); }
+    size_t write(const uint8_t *buf, size_t size);
+    int read();
+    int read(void *buf, uint16_t nbyte);
+    int peek();
+    int available();
+    void flush();
+    bool seek(uint32_t pos);
+    uint32_t position();
+    uint32_t size();
+    void close();
+    operator bool();
+    char *name();
+    bool isDirectory();
+    File openNextFile(uint8_t mode = O_RDONLY);
+    void rewindDirectory();
+
+ private:
+    friend class SDClass;
+    void release();
+    HostFile *f;
+};
+
+class SDClass
+{
+ public:
+    bool begin(uint8_t csPin = SS);
+    File open(const char *filepath, uint8_t mode = FILE_READ);
+    bool exists(const char *filepath);
+    bool mkdir(const char *filepath);
+    bool remove(const char *filepath);
+    bool rmdir(const char *filepath);
+
+    // Host side
+    void hostRoot(const char *dir); // default is the current directory
+    const char *hostPath(const char *filepath); // host path of a card file, valid until the next call
+    bool hostFail;                              // begin() fails, no card
+    unsigned long hostCalls;                    // open() and exists() calls, each is a directory search on the card
+    unsigned long hostWritten;                  // bytes written
+    uint32_t hostBlockUs;                       // [us] bus and busy time of a 512 byte block, every block
+                                                // write() touches and every flush() moves the clock by it
+    uint32_t hostFreeRun;                       // largest free area for createContiguous() in blocks, 0 = no limit
+};
+
+extern SDClass SD;
+
+#endif
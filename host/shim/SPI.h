@@ -0,0 +1,64 @@
+/*
+  SPI.h for the host build
+
+  SPI.transfer() and writes to SPDR both end in hostSpiHook, e.g. a model of
+  the display controller. Without a hook the bytes are only counted.
+  transfer() returns what the hook returns, 0xFF without one (no device).
+  hostSpiTransactions counts beginTransaction(), so a test can see how often
+  a sketch takes the bus. beginTransaction() sets SPCR and SPSR like the AVR
+  core, with hostCpuHz set every byte then moves the clock by 8 SPI clocks.
+*/
+
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+
+#include <Arduino.h>
+
+#define SPI_HAS_TRANSACTION 1
+
+#define SPI_CLOCK_DIV4 0x00
+#define SPI_CLOCK_DIV16 0x01
+#define SPI_CLOCK_DIV64 0x02
+#define SPI_CLOCK_DIV128 0x03
+#define SPI_CLOCK_DIV2 0x04
+#define SPI_CLOCK_DIV8 0x05
+#define SPI_CLOCK_DIV32 0x06
+
+#define SPI_MODE0 0x00
+#define SPI_MODE1 0x04
+#define SPI_MODE2 0x08
+#define SPI_MODE3 0x0C
+
+typedef uint8_t (*HostSpiHook)(uint8_t out);
+extern HostSpiHook hostSpiHook;
+extern unsigned long hostSpiBytes;
+extern unsigned long hostSpiTransactions;
+
+class SPISettings
+{
+ public:
+    SPISettings() : clock(4000000), bitOrder(MSBFIRST), dataMode(SPI_MODE0) {}
+    SPISettings(uint32_t clock, uint8_t bitOrder, uint8_t dataMode) : clock(clock), bitOrder(bitOrder), dataMode(dataMode) {}
+    uint32_t clock;
+    uint8_t bitOrder, dataMode;
+};
+
+class SPIClass
+{
+ public:
+    static void begin() {}
+    static void end() {}
+    static void beginTransaction(SPISettings settings);
+    static void endTransaction() {}
+    static void usingInterrupt(uint8_t) {}
+    static uint8_t transfer(uint8_t data);
+    static uint16_t transfer16(uint16_t data);
+    static void transfer(void *buf, size_t count);
+    static void setBitOrder(uint8_t) {}
+    static void setDataMode(uint8_t) {}
+    static void setClockDivider(uint8_t div);
+};
+
+extern SPIClass SPI;
+
+#endif
@@ -0,0 +1,20 @@
+/*
+  Stream.h for the host build
+*/
+
+#ifndef HOST_STREAM_H
+#define HOST_STREAM_H
+
+#include "Print.h"
+
+class Stream : public Print
+{
+ public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+    virtual void flush() {}
+    size_t readBytes(uint8_t *buffer, size_t length);
+};
+
+#endif
@@ -0,0 +1,11 @@
+/*
+  avr/interrupt.h for the host build, there are no interrupts to turn off
+*/
+
+#ifndef HOST_AVR_INTERRUPT_H
+#define HOST_AVR_INTERRUPT_H
+
+#define cli()
+#define sei()
+
+#endif
@@ -0,0 +1,58 @@
+/*
+  avr/io.h for the host build
+
+  The ATmega328 registers the sketches and libraries touch directly. The port
+  registers are plain bytes, PINx is refreshed from the host pin levels by
+  digitalRead() and hostSetPin(). SPDR is an object, every byte written to it
+  goes to the SPI hook of SPI.h. SPSR always reports a finished transfer,
+  only SPI2X can be written like on the AVR.
+*/
+
+#ifndef HOST_AVR_IO_H
+#define HOST_AVR_IO_H
+
+#include <stdint.h>
+
+#ifndef _BV
+#define _BV(bit) (1 << (bit))
+#endif
+
+extern volatile uint8_t PORTB, PORTC, PORTD;
+extern volatile uint8_t DDRB, DDRC, DDRD;
+extern volatile uint8_t PINB, PINC, PIND;
+
+struct HostSPDR {
+    HostSPDR &operator=(uint8_t b);
+    operator uint8_t() const;
+};
+extern HostSPDR SPDR;
+extern volatile uint8_t SPCR;
+
+struct HostSPSR {
+    uint8_t value;
+    HostSPSR &operator=(uint8_t b)
+    {
+        value = (b & 0x01) | 0x80; // SPI2X, SPIF is read only
+        return *this;
+    }
+    HostSPSR &operator|=(uint8_t b) { return *this = value | b; }
+    HostSPSR &operator&=(uint8_t b) { return *this = value & b; }
+    operator uint8_t() const { return value; }
+};
+extern HostSPSR SPSR;
+
+// SPCR
+#define SPIE 7
+#define SPE 6
+#define DORD 5
+#define MSTR 4
+#define CPOL 3
+#define CPHA 2
+#define SPR1 1
+#define SPR0 0
+// SPSR
+#define SPIF 7
+#define WCOL 6
+#define SPI2X 0
+
+#endif
@@ -0,0 +1,58 @@
+/*
+  avr/pgmspace.h for the host build, flash is ordinary memory here
+
+  On the AVR pointers are 16 bit and the libraries read pointer tables with
+  pgm_read_word(). Here pgm_read_word() of a pointer returns the whole pointer.
+*/
+
+#ifndef HOST_AVR_PGMSPACE_H
+#define HOST_AVR_PGMSPACE_H
+
+#include <stdint.h>
+#include <string.h>
+#ifdef __cplusplus
+#include <type_traits>
+#endif
+
+#define PROGMEM
+#define PGM_P const char *
+#define PSTR(s) (s)
+
+typedef char prog_char;
+typedef uint8_t prog_uint8_t;
+typedef uint16_t prog_uint16_t;
+typedef uint32_t prog_uint32_t;
+
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#ifdef __cplusplus
+template <typename T> struct HostPgmWord {
+    static uint16_t read(const void *addr) { return *(const uint16_t *)addr; }
+};
+template <typename T> struct HostPgmWord<T *> {
+    static uintptr_t read(const void *addr) { return (uintptr_t) * (T *const *)addr; }
+};
+template <typename T> inline auto hostPgmReadWord(const T *addr) -> decltype(HostPgmWord<typename std::remove_cv<T>::type>::read(addr))
+{
+    return HostPgmWord<typename std::remove_cv<T>::type>::read(addr);
+}
+#define pgm_read_word(addr) hostPgmReadWord(addr)
+#else
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#endif
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define pgm_read_float(addr) (*(const float *)(addr))
+#define pgm_read_ptr(addr) (*(void *const *)(addr))
+#define pgm_read_byte_near(addr) pgm_read_byte(addr)
+#define pgm_read_word_near(addr) pgm_read_word(addr)
+#define pgm_read_dword_near(addr) pgm_read_dword(addr)
+
+#define memcpy_P memcpy
+#define memcmp_P memcmp
+#define strlen_P strlen
+#define strcpy_P strcpy
+#define strcmp_P strcmp
+#define strncpy_P strncpy
+#define sprintf_P sprintf
+#define printf_P printf
+
+#endif
@@ -0,0 +1,22 @@
+/*
+  pins_arduino.h for the host build, the ATmega328 mapping of pins to ports:
+  0..7 PORTD, 8..13 PORTB, 14..19 (A0..A5) PORTC
+*/
+
+#ifndef HOST_PINS_ARDUINO_H
+#define HOST_PINS_ARDUINO_H
+
+#include <Arduino.h>
+
+#define NOT_A_PIN 0
+#define NOT_A_PORT 0
+#define PB 2
+#define PC 3
+#define PD 4
+
+#define SS 10
+#define MOSI 11
+#define MISO 12
+#define SCK 13
+
+#endif
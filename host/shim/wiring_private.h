@@ -0,0 +1,11 @@
+/*
+  wiring_private.h for the host build, nothing private is needed
+*/
+
+#ifndef HOST_WIRING_PRIVATE_H
+#define HOST_WIRING_PRIVATE_H
+
+#include <Arduino.h>
+#include <pins_arduino.h>
+
+#endif
@@ -0,0 +1,118 @@
+// buffer.h round trips: the integer codecs, the float codecs and the fixed point codec against the float one
+
+#include <buffer.h>
+#include <math.h>
+
+#include "test.h"
+
+// Every int16, the float and the fixed16 decode of one scale
+template <int32_t Scale>
+static long fixed16Mismatches()
+{
+    long bad = 0;
+    uint8_t b[2];
+    for (int32_t v = -32768; v < 32768; v++) {
+        int32_t i = 0;
+        buffer_append_int16(b, v, &i);
+        i = 0;
+        float f = buffer_get_float16(b, Scale, &i);
+        i = 0;
+        if (f != buffer_to_float<Scale>(buffer_get_fixed16<Scale>(b, &i))) bad++;
+    }
+    return bad;
+}
+
+// A sweep over the int32 range with a prime step, the float and the fixed32 decode of one scale
+template <int32_t Scale>
+static long fixed32Mismatches()
+{
+    long bad = 0;
+    uint8_t b[4];
+    for (int64_t v = INT32_MIN; v <= INT32_MAX; v += 977) {
+        int32_t i = 0;
+        buffer_append_int32(b, (int32_t)v, &i);
+        i = 0;
+        float f = buffer_get_float32(b, Scale, &i);
+        i = 0;
+        if (f != buffer_to_float<Scale>(buffer_get_fixed32<Scale>(b, &i))) bad++;
+    }
+    return bad;
+}
+
+// Rescaling against 64 bit math: scaling up is exact, scaling down truncates towards zero
+template <int32_t From, int32_t To>
+static long rescaleMismatches(int32_t limit)
+{
+    long bad = 0;
+    for (int64_t v = -limit; v <= limit; v += 7) {
+        int64_t want = To > From ? v * (To / From) : v / (From / To);
+        if (buffer_rescale<From, To>((int32_t)v) != want) bad++;
+    }
+    return bad;
+}
+
+int main()
+{
+    uint8_t b[8];
+    int32_t i;
+    long bad;
+
+    // Integers come back as they went in, big endian on the wire
+    bad = 0;
+    for (int32_t v = -32768; v < 32768; v++) {
+        i = 0;
+        buffer_append_int16(b, v, &i);
+        CHECK_EQ(i, 2);
+        i = 0;
+        if (buffer_get_int16(b, &i) != v) bad++;
+        i = 0;
+        buffer_append_uint16(b, v + 32768, &i);
+        i = 0;
+        if (buffer_get_uint16(b, &i) != v + 32768) bad++;
+    }
+    CHECK_EQ(bad, 0);
+    bad = 0;
+    for (int64_t v = INT32_MIN; v <= INT32_MAX; v += 977) {
+        i = 0;
+        buffer_append_int32(b, (int32_t)v, &i);
+        buffer_append_uint32(b, (uint32_t)(v - INT32_MIN), &i);
+        CHECK_EQ(i, 8);
+        i = 0;
+        if (buffer_get_int32(b, &i) != v) bad++;
+        if (buffer_get_uint32(b, &i) != (uint32_t)(v - INT32_MIN)) bad++;
+    }
+    CHECK_EQ(bad, 0);
+    i = 0;
+    buffer_append_int32(b, 0x12345678, &i);
+    CHECK(b[0] == 0x12 && b[1] == 0x34 && b[2] == 0x56 && b[3] == 0x78);
+
+    // Floats come back truncated towards zero, within one step of their scale
+    bad = 0;
+    for (int32_t v = -32000; v <= 32000; v += 3) {
+        float value = v / 10.0f + 0.03f;
+        i = 0;
+        buffer_append_float16(b, value, 10, &i);
+        buffer_append_float32(b, value / 10, 100, &i);
+        i = 0;
+        if (fabsf(buffer_get_float16(b, 10, &i) - value) > 0.1f + 1e-3f) bad++;
+        if (fabsf(buffer_get_float32(b, 100, &i) - value / 10) > 0.01f + 1e-4f) bad++;
+    }
+    CHECK_EQ(bad, 0);
+
+    // The fixed point decode gives the float decode of the old bldcMeasure, for every scale of COMM_GET_VALUES
+    CHECK_EQ(fixed16Mismatches<10>(), 0);
+    CHECK_EQ(fixed16Mismatches<1000>(), 0);
+    CHECK_EQ(fixed32Mismatches<100>(), 0);
+    CHECK_EQ(fixed32Mismatches<10000>(), 0);
+
+    // Scales other than the wire one
+    CHECK_EQ((rescaleMismatches<100, 1000>(INT32_MAX / 10)), 0);
+    CHECK_EQ((rescaleMismatches<10000, 10>(INT32_MAX)), 0);
+    CHECK_EQ((rescaleMismatches<1000, 1000>(INT32_MAX)), 0);
+    i = 0;
+    buffer_append_int32(b, -12345, &i);
+    i = 0;
+    CHECK_EQ((buffer_get_fixed32<100, 10>(b, &i)), -1234); // -123.45A to 0.1A, towards zero
+    CHECK_EQ(i, 4);
+    return TEST_RESULT;
+}
@@ -0,0 +1,175 @@
+// colorutils array functions with the scalar, SSE2 and AVX2 kernels against the per pixel loops of FastLED 3.1.3
+
+#include <FastLED.h>
+#include <colorutils_simd.h>
+
+#include "test.h"
+
+// The loops of FastLED 3.1.3, one CRGB at a time
+
+static void nscale8Ref(CRGB *leds, uint16_t count, uint8_t scale)
+{
+    for (uint16_t i = 0; i < count; i++)
+        leds[i].nscale8(scale);
+}
+
+static void nblendRef(CRGB *existing, CRGB *overlay, uint16_t count, fract8 amount)
+{
+    for (uint16_t i = 0; i < count; i++)
+        nblend(existing[i], overlay[i], amount);
+}
+
+static void blendRef(const CRGB *src1, const CRGB *src2, CRGB *dest, uint16_t count, fract8 amount)
+{
+    for (uint16_t i = 0; i < count; i++)
+        dest[i] = blend(src1[i], src2[i], amount);
+}
+
+static void blur1dRef(CRGB *leds, uint16_t count, fract8 amount)
+{
+    uint8_t keep = 255 - amount;
+    uint8_t seep = amount >> 1;
+    CRGB carryover = CRGB::Black;
+    for (uint16_t i = 0; i < count; i++) {
+        CRGB cur = leds[i];
+        CRGB part = cur;
+        part.nscale8(seep);
+        cur.nscale8(keep);
+        cur += carryover;
+        if (i) leds[i - 1] += part;
+        leds[i] = cur;
+        carryover = part;
+    }
+}
+
+static void gradientRef(CRGB *leds, uint16_t startpos, CRGB startcolor, uint16_t endpos, CRGB endcolor)
+{
+    if (endpos < startpos) {
+        uint16_t t = endpos;
+        CRGB tc = endcolor;
+        endcolor = startcolor;
+        endpos = startpos;
+        startpos = t;
+        startcolor = tc;
+    }
+    saccum87 rdistance87 = (endcolor.r - startcolor.r) << 7;
+    saccum87 gdistance87 = (endcolor.g - startcolor.g) << 7;
+    saccum87 bdistance87 = (endcolor.b - startcolor.b) << 7;
+    uint16_t pixeldistance = endpos - startpos;
+    int16_t divisor = pixeldistance ? pixeldistance : 1;
+    saccum87 rdelta87 = rdistance87 / divisor;
+    saccum87 gdelta87 = gdistance87 / divisor;
+    saccum87 bdelta87 = bdistance87 / divisor;
+    rdelta87 *= 2;
+    gdelta87 *= 2;
+    bdelta87 *= 2;
+    accum88 r88 = startcolor.r << 8;
+    accum88 g88 = startcolor.g << 8;
+    accum88 b88 = startcolor.b << 8;
+    for (uint16_t i = startpos; i <= endpos; i++) {
+        leds[i] = CRGB(r88 >> 8, g88 >> 8, b88 >> 8);
+        r88 += rdelta87;
+        g88 += gdelta87;
+        b88 += bdelta87;
+    }
+}
+
+static const uint16_t maxLeds = 1100;
+static const uint16_t sizes[] = {0, 1, 2, 5, 6, 10, 11, 12, 13, 16, 21, 22, 33, 64, 100, 341, 1000, 1099};
+
+static CRGB a[maxLeds], b[maxLeds], want[maxLeds], got[maxLeds];
+
+static void randomLeds(CRGB *leds)
+{
+    for (uint16_t i = 0; i < maxLeds; i++)
+        leds[i] = CRGB(random8(), random8(), random8());
+    // Runs of full and dark pixels for the saturation and the zero cases
+    for (uint16_t i = 0; i < maxLeds; i += 97)
+        for (uint16_t j = i; j < i + 7 && j < maxLeds; j++)
+            leds[j] = j & 1 ? CRGB(255, 255, 255) : CRGB(0, 0, 0);
+}
+
+static bool same(const CRGB *x, const CRGB *y, uint16_t count)
+{
+    return !memcmp(x, y, count * sizeof(CRGB));
+}
+
+// Every function over all amounts and the sizes, with the kernel set of level, against the loops above
+static long mismatches(uint8_t level)
+{
+    long bad = 0;
+
+    set_simd_level(level);
+    for (uint16_t n : sizes) {
+        for (int amount = 0; amount < 256; amount++) {
+            randomLeds(a);
+            randomLeds(b);
+
+            memcpy(want, a, sizeof(a));
+            memcpy(got, a, sizeof(a));
+            nscale8Ref(want, n, amount);
+            nscale8(got, n, amount);
+            bad += !same(want, got, maxLeds);
+
+            memcpy(want, a, sizeof(a));
+            memcpy(got, a, sizeof(a));
+            nscale8Ref(want, n, 255 - amount);
+            fadeToBlackBy(got, n, amount);
+            bad += !same(want, got, maxLeds);
+
+            memcpy(want, a, sizeof(a));
+            memcpy(got, a, sizeof(a));
+            nblendRef(want, b, n, amount);
+            nblend(got, b, n, amount);
+            bad += !same(want, got, maxLeds);
+
+            memset(want, 0, sizeof(want));
+            memset(got, 0, sizeof(got));
+            blendRef(a, b, want, n, amount);
+            blend(a, b, got, n, amount);
+            bad += !same(want, got, maxLeds);
+
+            memcpy(want, a, sizeof(a));
+            memcpy(got, a, sizeof(a));
+            blur1dRef(want, n, amount);
+            blur1d(got, n, amount);
+            bad += !same(want, got, maxLeds);
+        }
+    }
+
+    // Gradients up, down, flat and of one pixel, at every alignment of the start
+    for (int i = 0; i < 2000; i++) {
+        uint16_t start = random16(maxLeds), end = random16(maxLeds);
+        if (i % 10 == 0) end = start;
+        if (i % 10 == 1) end = min(start + random8(20), maxLeds - 1);
+        CRGB c1(random8(), random8(), random8()), c2(random8(), random8(), random8());
+        if (i % 7 == 0) c2 = c1;
+        memset(want, 0, sizeof(want));
+        memset(got, 0, sizeof(got));
+        gradientRef(want, start, c1, end, c2);
+        fill_gradient_RGB(got, start, c1, end, c2);
+        bad += !same(want, got, maxLeds);
+    }
+    return bad;
+}
+
+int main()
+{
+    random16_set_seed(1);
+
+    CHECK_EQ(mismatches(SIMD_SCALAR), 0);
+    CHECK_EQ(simd_level(), SIMD_SCALAR);
+    CHECK_EQ(mismatches(SIMD_SSE2), 0);
+    CHECK_EQ(simd_level(), SIMD_SSE2);
+    if (simd_supported() >= SIMD_AVX2) {
+        CHECK_EQ(mismatches(SIMD_AVX2), 0);
+        CHECK_EQ(simd_level(), SIMD_AVX2);
+    } else {
+        printf("no AVX2 on this CPU, its kernels are not checked\n");
+    }
+
+    // The level is capped at what the CPU has
+    set_simd_level(0xFE);
+    CHECK_EQ(simd_level(), simd_supported());
+    return TEST_RESULT;
+}
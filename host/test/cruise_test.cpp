@@ -0,0 +1,154 @@
+// MotorControl cruise against the VESC model: engage, nudge, a hill and the brake cancel, with settle time and overshoot
+
+#include <Arduino.h>
+#include <MotorControl.h>
+#include <VescUart.h>
+
+#include "VescModel.h"
+#include "test.h"
+
+static const int32_t minRpm = 2000; // cruise settings of the RX
+static const uint16_t rampRpm = 100;
+static const uint8_t nudgeRpm = 40;
+static const int8_t cancel = -64;
+
+static VescModel vesc;
+static MotorControl control;
+static RemoteDataStruct remote = {0, false, 10, 127, 250};
+static bldcMeasure values;
+
+struct Response {
+    int32_t min, max;  // [erpm] of the motor
+    int32_t final;     // [erpm] at the end, below the set speed by the P error of the VESC speed loop
+    uint32_t settleMs; // [ms] until it stays within 1% of the final speed
+};
+
+// The loop of the RX for ms: values when they are there, one command per period, 2 to 7ms a pass
+static Response ride(uint32_t ms)
+{
+    static int32_t trace[2000];
+    Response r = {0x7FFFFFFF, -0x7FFFFFFF, 0, 0};
+    uint32_t start = millis(), passes = 0;
+
+    while (millis() - start < ms) {
+        VescUartRequestValues();
+        VescUartGetValue(values);
+        if (control.update(remote, values)) {
+            switch (control.command()) {
+            case COMM_SET_RPM:
+                VescUartSetRPM(control.value());
+                break;
+            case COMM_SET_CURRENT_BRAKE:
+                VescUartSetCurrentBrakeMilli(control.value());
+                break;
+            default:
+                VescUartSetCurrentMilli(control.value());
+            }
+        }
+        delay(random(2, 8));
+        vesc.update();
+
+        int32_t rpm = vesc.vesc.rpm;
+        if (rpm < r.min) r.min = rpm;
+        if (rpm > r.max) r.max = rpm;
+        if (passes < 2000) trace[passes++] = millis() - start;
+        if (passes < 2000) trace[passes++] = rpm;
+    }
+    r.final = vesc.vesc.rpm;
+    for (uint32_t i = 0; i < passes; i += 2)
+        if (abs(trace[i + 1] - r.final) > r.final / 100)
+            r.settleMs = trace[i];
+    return r;
+}
+
+static void report(const char *name, const Response &r, int32_t set)
+{
+    printf("%-18s set %5ld erpm, settled to %5ld erpm in %4u ms, peak %3ld erpm above and %3ld below it\n", name, (long)set,
+           (long)r.final, r.settleMs, (long)max(r.max - r.final, 0), (long)max(r.final - r.min, 0));
+}
+
+int main()
+{
+    hostReset();
+    randomSeed(1);
+    Serial.begin(115200);
+    vesc.attach(Serial);
+    control.period(20);
+    control.ramps(1000, 4000, 1000, 4000);
+    control.cruise(minRpm, rampRpm, nudgeRpm, cancel);
+
+    // Below the lowest speed the button does nothing
+    remote.thr = 30;
+    remote.cruise = true;
+    ride(300);
+    CHECK(vesc.vesc.rpm < minRpm);
+    CHECK(!control.cruising());
+
+    // Up to speed, then cruise takes the speed of the last values
+    remote.thr = 80;
+    ride(2500);
+    remote.thr = 0;
+    ride(100);
+    CHECK(control.cruising());
+    CHECK_EQ(vesc.vesc.mode, VESC_RPM);
+    int32_t set = control.value();
+    CHECK(set > 6000);
+
+    // The speed loop of the VESC holds it within its P error against drag and load, 5%
+    Response r = ride(4000);
+    report("engage", r, set);
+    CHECK(r.settleMs < 1000);
+    CHECK(r.max - r.final <= r.final / 100);
+    CHECK(r.final > set * 95 / 100 && r.final <= set);
+
+    // Full stick for 1s raises the set speed by 50 periods of nudgeRpm
+    remote.thr = 127;
+    ride(1000);
+    remote.thr = 0;
+    CHECK_EQ(control.value(), set + 50 * nudgeRpm);
+    set = control.value();
+    r = ride(4000);
+    report("nudge +2000 erpm", r, set);
+    CHECK(r.settleMs < 1000);
+    CHECK(r.max - r.final <= r.final / 100);
+    CHECK(r.final > set * 95 / 100 && r.final <= set);
+
+    // A hill of 10A more load, the P error grows to 10%
+    vescSet(&vesc.vesc, "load", 10);
+    r = ride(4000);
+    report("hill, 10A load", r, set);
+    CHECK(r.settleMs < 1000);
+    CHECK(r.final - r.min <= r.final / 100);
+    CHECK(r.final > set * 90 / 100);
+    vescSet(&vesc.vesc, "load", 1);
+    ride(2000);
+
+    // Light braking only nudges down, harder braking hands over to the current ramps
+    remote.thr = -40;
+    ride(200);
+    CHECK(control.cruising());
+    CHECK(control.value() < set);
+    remote.thr = -100;
+    ride(20);
+    CHECK(!control.cruising());
+    CHECK(control.command() == COMM_SET_CURRENT_BRAKE || control.value() <= 4000); // no jump from the held speed
+    ride(3000);
+    CHECK_EQ(vesc.vesc.rpm, 0);
+    CHECK_EQ(vesc.vesc.mode, VESC_BRAKE);
+
+    // Cancelled cruise stays off until the button is released, even when up to speed again
+    remote.thr = 80;
+    ride(2500);
+    remote.thr = 0;
+    ride(200);
+    CHECK(!control.cruising());
+    remote.cruise = false;
+    ride(100);
+    remote.cruise = true;
+    ride(100);
+    CHECK(control.cruising());
+
+    CHECK_EQ(vesc.badFrames, 0);
+    CHECK(vesc.maxGapMs <= 40);
+    return TEST_RESULT;
+}
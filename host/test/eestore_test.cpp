@@ -0,0 +1,132 @@
+// EEStore with the settings record of the TX: defaults, wear levelling, torn writes and version changes
+
+#include <Arduino.h>
+#include <EEPROM.h>
+#include <EEStore.h>
+
+#include "test.h"
+
+struct Settings {
+    uint8_t deadband, amp_fwd_max, amp_break_max, amp_fwd_min, amp_break_min, maxvolt;
+};
+static const Settings defaults PROGMEM = {10, 60, 100, 20, 20, 210};
+
+static const uint16_t base = 16;
+static const uint8_t slots = 64;
+static const uint8_t slotSize = sizeof(Settings) + 4;
+
+static void testDefaults()
+{
+    Settings s;
+    EEStore store(base, slots);
+
+    EEPROM.hostErase();
+    CHECK(!store.begin(&s, sizeof(s), &defaults, 1));
+    CHECK_EQ(s.deadband, 10);
+    CHECK_EQ(s.maxvolt, 210);
+    CHECK(!store.dirty());
+    CHECK(!store.save()); // nothing changed, nothing written
+    CHECK_EQ(EEPROM.writes[base], 0);
+}
+
+static void testSaveLoad()
+{
+    Settings s, t;
+    EEStore store(base, slots), again(base, slots);
+
+    EEPROM.hostErase();
+    store.begin(&s, sizeof(s), &defaults, 1);
+    s.amp_fwd_max = 80;
+    CHECK(store.dirty());
+    CHECK(store.changed(offsetof(Settings, amp_fwd_max)));
+    CHECK(!store.changed(offsetof(Settings, deadband)));
+    CHECK(store.save());
+    CHECK(!store.dirty());
+
+    CHECK(again.begin(&t, sizeof(t), &defaults, 1));
+    CHECK_EQ(t.amp_fwd_max, 80);
+    CHECK_EQ(t.deadband, 10);
+
+    s.deadband = 3;
+    store.revert();
+    CHECK_EQ(s.deadband, 10);
+}
+
+// 300 saves go round the slots, the newest survives and no cell wears much more than 300 / slots
+static void testWear()
+{
+    Settings s, t;
+    EEStore store(base, slots), again(base, slots);
+    unsigned most = 0;
+
+    EEPROM.hostErase();
+    store.begin(&s, sizeof(s), &defaults, 1);
+    for (int i = 0; i < 300; i++) {
+        s.deadband = i;
+        CHECK(store.save());
+    }
+    CHECK(again.begin(&t, sizeof(t), &defaults, 1));
+    CHECK_EQ(t.deadband, (uint8_t)299);
+
+    for (int i = 0; i < EEPROM.length(); i++)
+        if (EEPROM.writes[i] > most) most = EEPROM.writes[i];
+    CHECK(most <= 300 / slots + 1);
+}
+
+// A record with a broken CRC is skipped, the one before it is taken
+static void testTorn()
+{
+    Settings s, t;
+    EEStore store(base, slots), again(base, slots);
+
+    EEPROM.hostErase();
+    store.begin(&s, sizeof(s), &defaults, 1);
+    for (int i = 0; i < 300; i++) {
+        s.deadband = i;
+        store.save();
+    }
+    EEPROM.mem[base + (299 % slots) * slotSize + 3] ^= 1;
+    CHECK(again.begin(&t, sizeof(t), &defaults, 1));
+    CHECK_EQ(t.deadband, (uint8_t)298);
+}
+
+// seq wraps at 256, the newest record is still found
+static void testSeqWrap()
+{
+    Settings s, t;
+    EEStore store(base, 4), again(base, 4);
+
+    EEPROM.hostErase();
+    store.begin(&s, sizeof(s), &defaults, 1);
+    for (int i = 0; i < 260; i++) {
+        s.deadband = i;
+        store.save();
+    }
+    CHECK(again.begin(&t, sizeof(t), &defaults, 1));
+    CHECK_EQ(t.deadband, (uint8_t)259);
+}
+
+static void testVersion()
+{
+    Settings s, t;
+    EEStore store(base, slots), other(base, slots);
+
+    EEPROM.hostErase();
+    store.begin(&s, sizeof(s), &defaults, 1);
+    s.deadband = 30;
+    store.save();
+    CHECK(!other.begin(&t, sizeof(t), &defaults, 2));
+    CHECK_EQ(t.deadband, 10);
+}
+
+int main()
+{
+    hostReset();
+    testDefaults();
+    testSaveLoad();
+    testWear();
+    testTorn();
+    testSeqWrap();
+    testVersion();
+    return TEST_RESULT;
+}
@@ -0,0 +1,103 @@
+// EnergyMeter on a recorded ride: energy, resistance, sag compensated SoC and Wh/km against the values of the log
+
+#include <Arduino.h>
+#include <EnergyMeter.h>
+#include <math.h>
+#include <vector>
+
+#include "test.h"
+
+// Only here, its <fcntl.h> defines O_CREAT and the other open flags of SD.h as macros
+#include "logreader.h"
+
+// The battery of tools/loggen: open circuit 40V - 0.4V per Ah used, 150 mOhm
+static double ocvOf(double ah) { return 40 - ah * 0.4; }
+static const uint16_t loggenRes = 150;  // [mOhm]
+static const int16_t empty = 300;       // [0.1V]
+static const int16_t full = 420;        // [0.1V]
+static const uint16_t capacity = 500;   // [Wh]
+
+static double socOf(double volt)
+{
+    return fmin(fmax((volt * 10 - empty) * 255 / (full - empty), 0), 255);
+}
+
+int main()
+{
+    static logReader r;
+    EnergyMeter meter;
+    const uint8_t *sample;
+
+    const char *error = logOpen(&r, HOST_LOG_DIR "/ride.BIN");
+    CHECK(!error);
+    if (error) {
+        printf("%s: %s\n", HOST_LOG_DIR "/ride.BIN", error);
+        return TEST_RESULT;
+    }
+    int fIn = logFieldIndex(&r, "current_in");
+    int fVolt = logFieldIndex(&r, "v_in");
+    int fAh = logFieldIndex(&r, "amp_hours");
+    int fAhc = logFieldIndex(&r, "amp_hours_charged");
+    int fTacho = logFieldIndex(&r, "tachometerAbs");
+    CHECK(fIn >= 0 && fVolt >= 0 && fAh >= 0 && fAhc >= 0 && fTacho >= 0);
+
+    meter.battery(empty, full, capacity);
+    meter.distance(1 / r.header.ratio_TachoDist);
+    meter.resistance(50); // it has to find the 150 of the log
+    meter.consumption(200);
+
+    // Energy [Wh] and distance [km] from the start, per sample, for the window of the last km
+    std::vector<double> energyAt, kmAt;
+    double energy = 0, km = 0, lastTacho = 0, lastVolt = 0, lastAh = 0;
+    double socError = 0, rawError = 0, whKmError = 0, rangeError = 0;
+    long samples = 0;
+
+    while ((sample = logNextSample(&r))) {
+        double in = logValue(&r.fields[fIn], sample);
+        double volt = logValue(&r.fields[fVolt], sample);
+        double ah = logValue(&r.fields[fAh], sample), ahc = logValue(&r.fields[fAhc], sample);
+        double tacho = logValue(&r.fields[fTacho], sample);
+
+        meter.update(lround(volt * 10), lround(in * 100), lround(ah * 10000), lround(ahc * 10000), lround(tacho));
+
+        if (samples) {
+            energy += (ah - ahc - lastAh) * (volt + lastVolt) / 2;
+            km += (tacho - lastTacho) * r.header.ratio_TachoDist;
+        }
+        lastAh = ah - ahc;
+        lastVolt = volt;
+        lastTacho = tacho;
+        energyAt.push_back(energy);
+        kmAt.push_back(km);
+        samples++;
+
+        // Once the resistance has settled, 10 minutes in
+        if (samples < 6000)
+            continue;
+        socError = fmax(socError, fabs(meter.soc() - socOf(ocvOf(ah))));
+        rawError = fmax(rawError, fabs(socOf(volt) - socOf(ocvOf(ah))));
+        if (samples % 100 == 0 && km > 1.5) {
+            size_t k = kmAt.size() - 1;
+            while (k && kmAt[k] > km - 1) k--;
+            double whKm = (energy - energyAt[k]) / (km - kmAt[k]);
+            whKmError = fmax(whKmError, fabs(meter.whKm() / 10.0 - whKm) / whKm);
+            double range = meter.soc() / 255.0 * capacity / (meter.whKm() / 10.0);
+            rangeError = fmax(rangeError, fabs(meter.range() / 10.0 - range));
+        }
+    }
+    logClose(&r);
+
+    printf("%ld samples, %.2f km, %.1f Wh, meter %.1f Wh, %u mOhm\n", samples, km, energy, meter.used() / 10.0,
+           meter.resistance());
+    printf("worst SoC error %.1f of 255, %.1f without sag compensation, Wh/km %.1f%%, range %.2f km\n", socError,
+           rawError, whKmError * 100, rangeError);
+
+    CHECK(samples > 6000);
+    CHECK(fabs(meter.used() / 10.0 - energy) < 0.1 + energy * 0.001);
+    CHECK(abs(meter.resistance() - loggenRes) <= 15);
+    CHECK(socError < 10);              // 0.5V of 12V, 0.1V of v_in is ~7% of a 10A step, R wanders by 10%
+    CHECK(socError < rawError / 5);
+    CHECK(whKmError < 0.1);            // the open segment is not in the window
+    CHECK(rangeError < 0.2);
+    return TEST_RESULT;
+}
@@ -0,0 +1,74 @@
+// LedPower over random edits of the RX strips: the running sums, power and brightness against a scan of the buffer
+
+#include <Arduino.h>
+#include <LedPower.h>
+
+#include "test.h"
+
+static const uint8_t ledCount = 14;         // per strip, as on the RX
+static const uint16_t ledMaxPower = 3000;   // [mW] budget of the RX
+
+// Both strips of the RX in one buffer, so the scan of FastLED sees them at once
+static CRGB leds[257];
+
+static CRGB randomColor()
+{
+    // Full and dark channels often, for the ends of the sums
+    switch (random(4)) {
+    case 0: return CRGB(0, 0, 0);
+    case 1: return CRGB(255, 255, 255);
+    default: return CRGB(random(256), random(256), random(256));
+    }
+}
+
+// Returns the number of edits after which the sums, power or brightness differ from a scan of num leds
+static long mismatches(uint16_t num, long edits)
+{
+    LedPower power;
+    long bad = 0;
+
+    memset(leds, 0, sizeof(leds));
+    for (long n = 0; n < edits; n++) {
+        if (random(16) == 0) {
+            uint8_t start = random(num), count = random(1, num - start + 1);
+            power.fill(&leds[start], count, randomColor());
+        } else {
+            power.set(&leds[random(num)], randomColor());
+        }
+
+        uint32_t sum[3] = {0, 0, 0};
+        for (uint16_t i = 0; i < num; i++) {
+            sum[0] += leds[i].r;
+            sum[1] += leds[i].g;
+            sum[2] += leds[i].b;
+        }
+        bad += power.sum(0) != sum[0] || power.sum(1) != sum[1] || power.sum(2) != sum[2] ||
+               power.power(num) != calculate_unscaled_power_mW(leds, num) ||
+               power.brightness(num, 255, ledMaxPower) != calculate_max_brightness_for_power_mW(leds, num, 255, ledMaxPower) ||
+               power.brightness(num, 128, ledMaxPower) != calculate_max_brightness_for_power_mW(leds, num, 128, ledMaxPower);
+    }
+    return bad;
+}
+
+int main()
+{
+    randomSeed(3);
+
+    CHECK_EQ(mismatches(2 * ledCount, 200000), 0);
+    CHECK_EQ(mismatches(1, 1000), 0);
+    CHECK_EQ(mismatches(255, 20000), 0); // fill() takes up to 255 leds, the sums hold 257 at full white
+
+    // The strips of the RX: the white front and red rear of setup() are capped, the dark strips are not
+    LedPower power;
+    CRGB fwd[ledCount], back[ledCount];
+    memset(fwd, 0, sizeof(fwd));
+    memset(back, 0, sizeof(back));
+    CHECK_EQ(power.brightness(2 * ledCount, 255, ledMaxPower), 255);
+    power.fill(fwd, ledCount, CRGB(230, 230, 255));
+    power.fill(back, ledCount, CRGB(150, 0, 0));
+    CHECK(power.brightness(2 * ledCount, 255, ledMaxPower) < 255);
+    CHECK(power.power(2 * ledCount) * power.brightness(2 * ledCount, 255, ledMaxPower) / 256 <= ledMaxPower);
+    printf("RX strips white/red: %lu mW unscaled, brightness %d\n", (unsigned long)power.power(2 * ledCount),
+           power.brightness(2 * ledCount, 255, ledMaxPower));
+    return TEST_RESULT;
+}
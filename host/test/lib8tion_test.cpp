@@ -0,0 +1,371 @@
+// lib8tion C paths against their AVR asm paths, over every input of the 8 bit functions and the 16 by 8 bit ones
+//
+// The host compiles the C fallbacks of FastLED-3.1.3/lib8tion, the asm
+// blocks can't run here. Each one is written out below instruction by
+// instruction on a model of the AVR registers and flags, in the order of the
+// header, and both have to give the same result for every input. The 16 by
+// 16 bit functions take every i with a sweep of the second argument.
+
+#include <stdint.h>
+#include <stdio.h>
+
+// The "unspecified architecture" settings of lib8tion.h, everything in C
+#define LIB8STATIC __attribute__((unused)) static inline
+#define LIB8STATIC_ALWAYS_INLINE __attribute__((always_inline)) static inline
+#define FASTLED_SCALE8_FIXED 1 // as in fastled_config.h
+#define QADD8_C 1
+#define QADD7_C 1
+#define QSUB8_C 1
+#define SCALE8_C 1
+#define SCALE16BY8_C 1
+#define SCALE16_C 1
+#define ABS8_C 1
+#define MUL8_C 1
+#define QMUL8_C 1
+#define ADD8_C 1
+#define SUB8_C 1
+#define EASE8_C 1
+#define AVG8_C 1
+#define AVG7_C 1
+#define AVG16_C 1
+#define AVG15_C 1
+typedef uint8_t fract8;
+typedef uint16_t fract16;
+
+#include <lib8tion/math8.h>
+#include <lib8tion/scale8.h>
+#include <lib8tion/trig8.h>
+
+#include "test.h"
+
+// The AVR instructions of the asm blocks with the flags they set, r1:r0 hold the product of mul
+struct Avr {
+    uint8_t r0, r1;
+    bool C, Z, V;
+
+    Avr() : r0(0), r1(0), C(false), Z(false), V(false) {}
+    void mul(uint8_t a, uint8_t b)
+    {
+        uint16_t p = a * b;
+        r0 = p;
+        r1 = p >> 8;
+        C = p >> 15;
+        Z = !p;
+    }
+    void add(uint8_t &d, uint8_t s) { adc(d, s, false); }
+    void adc(uint8_t &d, uint8_t s) { adc(d, s, C); }
+    void adc(uint8_t &d, uint8_t s, bool c)
+    {
+        uint8_t t = d + s + c;
+        V = (d ^ t) & (s ^ t) & 0x80;
+        C = d + s + c > 0xFF;
+        Z = !t;
+        d = t;
+    }
+    void sub(uint8_t &d, uint8_t s)
+    {
+        uint8_t t = d - s;
+        V = (d ^ s) & (d ^ t) & 0x80;
+        C = s > d;
+        Z = !t;
+        d = t;
+    }
+    void ror(uint8_t &d)
+    {
+        bool c = d & 1;
+        d = d >> 1 | C << 7;
+        C = c;
+        Z = !d;
+    }
+    void asr(uint8_t &d)
+    {
+        C = d & 1;
+        d = d >> 1 | (d & 0x80);
+        Z = !d;
+    }
+    void lsr(uint8_t &d)
+    {
+        C = d & 1;
+        d >>= 1;
+        Z = !d;
+    }
+    void tst(uint8_t d) { Z = !d; }
+    void inc(uint8_t &d) { Z = !++d; }       // C stays
+    void neg(uint8_t &d) { d = -d; }
+    void com(uint8_t &d) { d = ~d; }
+    void swap(uint8_t &d) { d = d << 4 | d >> 4; }
+};
+
+static uint8_t scale8_asm(uint8_t i, uint8_t scale)
+{
+    Avr a;
+    a.mul(i, scale);
+    a.add(a.r0, i);
+    i = 0; // ldi
+    a.adc(i, a.r1);
+    return i;
+}
+
+// Only built with SCALE8_AVRASM on an ATtiny, lib8tion.h gives the ATtiny the C path. The loop shifts in
+// the carry it was entered with when scale + 1 is even, this runs it with the carry clear.
+static uint8_t scale8_attiny_asm(uint8_t i, uint8_t scale)
+{
+    Avr a;
+    uint8_t work = i, cnt = 0x80;
+    a.inc(scale);
+    if (a.Z) return work; // breq DONE
+    work = 0;
+    do {
+        if (scale & 1) a.add(work, i); // sbrc
+        a.ror(work);
+        a.lsr(scale);
+        a.lsr(cnt);
+    } while (!a.C);
+    return work;
+}
+
+static uint8_t scale8_video_asm(uint8_t i, uint8_t scale)
+{
+    Avr a;
+    uint8_t j = 0;
+    a.tst(i);
+    if (a.Z) return j;
+    a.mul(i, scale);
+    j = a.r1;
+    a.r1 = 0;                         // clr __zero_reg__
+    if (scale != a.r1) j -= 0xFF;     // cpse, subi
+    return j;
+}
+
+// The _LEAVING_R1_DIRTY variant branches on the Z of mul
+static uint8_t scale8_video_dirty_asm(uint8_t i, uint8_t scale)
+{
+    Avr a;
+    uint8_t j = 0;
+    a.tst(i);
+    if (a.Z) return j;
+    a.mul(i, scale);
+    j = a.r1;
+    if (a.Z) return j;
+    return j - 0xFF;
+}
+
+static uint16_t scale16by8_asm(uint16_t i, uint8_t scale)
+{
+    Avr a;
+    uint8_t iA = i, iB = i >> 8, resA = 0, resB = 0;
+    a.mul(iA, scale);
+    a.add(a.r0, iA);
+    a.adc(resA, a.r1);
+    a.mul(iB, scale);
+    a.add(resA, a.r0);
+    a.adc(resB, a.r1);
+    a.r1 = 0;
+    a.add(resA, iB);
+    a.adc(resB, a.r1);
+    return resA | resB << 8;
+}
+
+static uint16_t scale16_asm(uint16_t i, uint16_t scale)
+{
+    Avr a;
+    uint8_t iA = i, iB = i >> 8, sA = scale, sB = scale >> 8, zero = 0;
+    uint8_t res[4];
+    a.mul(iA, sA);
+    res[0] = a.r0; // movw
+    res[1] = a.r1;
+    a.mul(iB, sB);
+    res[2] = a.r0;
+    res[3] = a.r1;
+    a.mul(iB, sA);
+    a.add(res[1], a.r0);
+    a.adc(res[2], a.r1);
+    a.adc(res[3], zero);
+    a.mul(iA, sB);
+    a.add(res[1], a.r0);
+    a.adc(res[2], a.r1);
+    a.adc(res[3], zero);
+    a.add(res[0], iA);
+    a.adc(res[1], iB);
+    a.adc(res[2], zero);
+    a.adc(res[3], zero);
+    return res[2] | res[3] << 8;
+}
+
+static uint8_t qadd8_asm(uint8_t i, uint8_t j)
+{
+    Avr a;
+    a.add(i, j);
+    if (a.C) i = 0xFF;
+    return i;
+}
+
+static int8_t qadd7_asm(int8_t si, int8_t sj)
+{
+    Avr a;
+    uint8_t i = si, j = sj;
+    a.add(i, j);
+    if (a.V) {
+        i = 0x7F;
+        if (j & 0x80) i = 0x80; // sbrc
+    }
+    return i;
+}
+
+static uint8_t qsub8_asm(uint8_t i, uint8_t j)
+{
+    Avr a;
+    a.sub(i, j);
+    if (a.C) i = 0;
+    return i;
+}
+
+static uint8_t avg8_asm(uint8_t i, uint8_t j)
+{
+    Avr a;
+    a.add(i, j);
+    a.ror(i);
+    return i;
+}
+
+static uint16_t avg16_asm(uint16_t i, uint16_t j)
+{
+    Avr a;
+    uint8_t iA = i, iB = i >> 8;
+    a.add(iA, j);
+    a.adc(iB, j >> 8);
+    a.ror(iB);
+    a.ror(iA);
+    return iA | iB << 8;
+}
+
+static int8_t avg7_asm(int8_t si, int8_t sj)
+{
+    Avr a;
+    uint8_t i = si, j = sj;
+    a.asr(j);
+    a.asr(i);
+    a.adc(i, j);
+    return i;
+}
+
+static int16_t avg15_asm(int16_t i, int16_t j)
+{
+    Avr a;
+    uint8_t iA = i, iB = (uint16_t)i >> 8, jA = j, jB = (uint16_t)j >> 8;
+    a.asr(jB);
+    a.ror(jA);
+    a.asr(iB);
+    a.ror(iA);
+    a.adc(iA, jA);
+    a.adc(iB, jB);
+    return (int16_t)(iA | iB << 8);
+}
+
+static uint8_t mul8_asm(uint8_t i, uint8_t j)
+{
+    Avr a;
+    a.mul(i, j);
+    return a.r0;
+}
+
+static uint8_t qmul8_asm(uint8_t i, uint8_t j)
+{
+    Avr a;
+    a.mul(i, j);
+    a.tst(a.r1);
+    return a.Z ? a.r0 : 0xFF;
+}
+
+static int8_t abs8_asm(int8_t si)
+{
+    Avr a;
+    uint8_t i = si;
+    if (i & 0x80) a.neg(i); // sbrc
+    return i;
+}
+
+// sin8_avr with its two asm blocks
+static uint8_t sin8_asm(uint8_t theta)
+{
+    Avr a;
+    uint8_t offset = theta;
+    if (theta & 0x40) a.com(offset); // sbrc
+    offset &= 0x3F;
+    uint8_t secoffset = offset & 0x0F;
+    if (theta & 0x40) secoffset++;
+    uint8_t section = offset >> 4;
+    uint8_t b = b_m16_interleave[section * 2], m16 = b_m16_interleave[section * 2 + 1];
+    a.mul(m16, secoffset);
+    uint8_t mx = a.r0, xr1 = a.r1;
+    a.swap(mx);
+    mx &= 0x0F;
+    a.swap(xr1);
+    xr1 &= 0xF0;
+    mx |= xr1;
+    int8_t y = mx + b;
+    if (theta & 0x80) y = -y;
+    y += 128;
+    return y;
+}
+
+int main()
+{
+    long bad[16] = {0};
+    enum { SCALE8, SCALE8_TINY, VIDEO, VIDEO_DIRTY, QADD8, QADD7, QSUB8, AVG8, AVG7, MUL8, QMUL8, ABS8, SIN8 };
+
+    for (int i = 0; i < 256; i++) {
+        for (int j = 0; j < 256; j++) {
+            bad[SCALE8] += scale8(i, j) != scale8_asm(i, j) || scale8_LEAVING_R1_DIRTY(i, j) != scale8_asm(i, j);
+            bad[SCALE8_TINY] += scale8(i, j) != scale8_attiny_asm(i, j);
+            bad[VIDEO] += scale8_video(i, j) != scale8_video_asm(i, j);
+            bad[VIDEO_DIRTY] += scale8_video_LEAVING_R1_DIRTY(i, j) != scale8_video_dirty_asm(i, j);
+            bad[QADD8] += qadd8(i, j) != qadd8_asm(i, j);
+            bad[QADD7] += qadd7(i, j) != qadd7_asm(i, j);
+            bad[QSUB8] += qsub8(i, j) != qsub8_asm(i, j);
+            bad[AVG8] += avg8(i, j) != avg8_asm(i, j);
+            bad[AVG7] += avg7(i, j) != avg7_asm(i, j);
+            bad[MUL8] += mul8(i, j) != mul8_asm(i, j);
+            bad[QMUL8] += qmul8(i, j) != qmul8_asm(i, j);
+        }
+        bad[ABS8] += abs8(i) != abs8_asm(i);
+        bad[SIN8] += sin8_C(i) != sin8_asm(i);
+    }
+    CHECK_EQ(bad[SCALE8], 0);
+    CHECK_EQ(bad[SCALE8_TINY], 0);
+    CHECK_EQ(bad[VIDEO], 0);
+    CHECK_EQ(bad[VIDEO_DIRTY], 0);
+    CHECK_EQ(bad[QADD8], 0);
+    CHECK_EQ(bad[QADD7], 0);
+    CHECK_EQ(bad[QSUB8], 0);
+    CHECK_EQ(bad[AVG8], 0);
+    CHECK_EQ(bad[AVG7], 0);
+    CHECK_EQ(bad[MUL8], 0);
+    CHECK_EQ(bad[QMUL8], 0);
+    CHECK_EQ(bad[ABS8], 0);
+    CHECK_EQ(bad[SIN8], 0);
+
+    // 16 by 8 bits and sin16 over every input
+    long scale16by8Bad = 0, sin16Bad = 0;
+    for (uint32_t i = 0; i < 65536; i++) {
+        for (int s = 0; s < 256; s++)
+            scale16by8Bad += scale16by8(i, s) != scale16by8_asm(i, s);
+        sin16Bad += sin16_C(i) != sin16_avr(i);
+    }
+    CHECK_EQ(scale16by8Bad, 0);
+    CHECK_EQ(sin16Bad, 0);
+
+    // 16 by 16 bits: every i with 766 values of the second argument, all carries of the low byte and the ends
+    long scale16Bad = 0, avg16Bad = 0, avg15Bad = 0;
+    for (uint32_t i = 0; i < 65536; i++) {
+        for (uint32_t j = 0; j < 65536; j += j < 256 || j >= 65280 ? 1 : 255) {
+            scale16Bad += scale16(i, j) != scale16_asm(i, j);
+            avg16Bad += avg16(i, j) != avg16_asm(i, j);
+            avg15Bad += avg15(i, j) != avg15_asm(i, j);
+        }
+    }
+    CHECK_EQ(scale16Bad, 0);
+    CHECK_EQ(avg16Bad, 0);
+    CHECK_EQ(avg15Bad, 0);
+    return TEST_RESULT;
+}
@@ -0,0 +1,130 @@
+// MotorControl over stick traces: one command per period, ramp steps, glitches and the latency the ramps add
+
+#include <Arduino.h>
+#include <MotorControl.h>
+
+#include "test.h"
+
+static const uint8_t period = 20;           // [ms] cmdPeriod of the RX
+static const uint16_t driveUp = 1000;       // [mA/period] ramps of the RX
+static const uint16_t driveDown = 4000;
+static const uint16_t brakeUp = 1000;
+static const uint16_t brakeDown = 4000;
+
+// Stick position at ms
+typedef int8_t (*Trace)(uint32_t ms);
+
+static int8_t fullStep(uint32_t ms) { return ms >= 500 && ms < 3000 ? 127 : 0; }
+static int8_t noisy(uint32_t ms) { return ms >= 500 ? 60 + random(-15, 16) : 0; }
+static int8_t glitch(uint32_t ms) { return ms >= 1000 && ms < 1020 ? 127 : 0; } // one packet, held for a period
+static int8_t reverse(uint32_t ms) { return ms < 500 ? 0 : ms < 2500 ? 100 : -100; }
+
+struct Result {
+    uint32_t commands, passes;
+    uint32_t sameTick;      // passes with more than one command
+    int32_t maxStep;        // [mA] largest change between two commands
+    int32_t maxCurrent;     // [mA]
+    int32_t zeroCross;      // commands at 0A between drive and brake
+    uint32_t settleMs;      // [ms] from the last target change until the command holds the target
+    double rmsError;        // [mA] command against target
+};
+
+static Result run(const char *name, Trace trace, uint32_t ms)
+{
+    MotorControl control;
+    RemoteDataStruct remote = {0, false, 10, 127, 250}; // deadband 10, 63.5A drive, 25A brake
+    bldcMeasure vesc;
+    Result r;
+    int32_t last = 0, target, lastTarget = 0;
+    uint32_t start, changed = 0, settled = 0;
+    double sumSquare = 0;
+    bool wasDrive = false;
+
+    memset(&r, 0, sizeof(r));
+    memset(&vesc, 0, sizeof(vesc));
+    control.period(period);
+    control.ramps(driveUp, driveDown, brakeUp, brakeDown);
+    start = millis();
+
+    while (millis() - start < ms) {
+        // Loop passes of 2 to 7ms, one stall of 45ms while the LEDs are shown
+        hostAdvance(millis() - start == 1500 ? 45000 : random(2000, 7001));
+        uint32_t t = millis() - start;
+        remote.thr = trace(t);
+        target = control.target(remote);
+        if (target != lastTarget) {
+            changed = t;
+            settled = 0;
+            lastTarget = target;
+        }
+        r.passes++;
+
+        uint32_t before = r.commands;
+        while (control.update(remote, vesc)) // a second command in the same pass would be a burst
+            r.commands++;
+        if (r.commands - before > 1) r.sameTick++;
+        if (r.commands == before) continue;
+
+        int32_t current = control.command() == COMM_SET_CURRENT_BRAKE ? -control.value() : control.value();
+        CHECK(control.command() != COMM_SET_RPM);
+        if (abs(current - last) > r.maxStep) r.maxStep = abs(current - last);
+        if (abs(current) > r.maxCurrent) r.maxCurrent = abs(current);
+        if (current > 0) wasDrive = true;
+        if (current < 0 && wasDrive) wasDrive = false;
+        if (!current && wasDrive && target < 0) r.zeroCross++;
+        if (current == target && !settled) settled = t;
+        if (current != target) settled = 0;
+        sumSquare += (double)(current - target) * (current - target);
+        last = current;
+    }
+    r.settleMs = settled ? settled - changed : ms;
+    r.rmsError = sqrt(sumSquare / r.commands);
+    printf("%-22s %5.1f commands/s, max step %5.2f A, settled %5u ms after the last change, rms error %5.2f A\n", name,
+           r.commands * 1000.0 / ms, r.maxStep / 1000.0, r.settleMs, r.rmsError / 1000.0);
+    return r;
+}
+
+int main()
+{
+    hostReset();
+    randomSeed(1);
+
+    // Full stick: 63.5A at 50A/s take 1.27s, release at 200A/s takes 0.32s
+    Result r = run("full throttle 0.5-3s", fullStep, 5000);
+    CHECK(r.commands >= 5000 / period - 1 && r.commands <= 5000 / period);
+    CHECK_EQ(r.sameTick, 0);
+    CHECK_EQ(r.maxStep, driveDown);
+    CHECK_EQ(r.maxCurrent, 63500);
+    CHECK(r.settleMs <= 340);
+
+    // A noisy stick moves the command by at most one ramp step per period
+    r = run("noisy stick", noisy, 5000);
+    CHECK(r.commands >= 5000 / period - 1 && r.commands <= 5000 / period);
+    CHECK(r.maxStep <= driveDown);
+    CHECK(r.maxCurrent <= 75 * 500L); // 500mA per step of the stick
+
+    // One glitched packet of full stick gives one step of rampDriveUp, not 63.5A
+    r = run("one glitched packet", glitch, 3000);
+    CHECK(r.maxCurrent <= driveUp);
+    CHECK(r.settleMs <= 2 * period);
+
+    // Drive into brake goes through zero without a command at 0A
+    r = run("drive to brake", reverse, 5000);
+    CHECK_EQ(r.zeroCross, 0);
+    CHECK(r.maxStep <= driveDown + brakeUp);
+    CHECK_EQ(r.maxCurrent, 50000);
+    CHECK(r.settleMs < 1000);
+
+    // Deadband and limits of the remote
+    MotorControl control;
+    RemoteDataStruct remote = {10, false, 10, 127, 250};
+    CHECK_EQ(control.target(remote), 0);
+    remote.thr = 11;
+    CHECK_EQ(control.target(remote), 5500);
+    remote.thr = -127;
+    CHECK_EQ(control.target(remote), -25000);
+    remote._amp_break = 0; // the safe values after a timeout
+    CHECK_EQ(control.target(remote), 0);
+
+    return TEST_RESULT;
+}
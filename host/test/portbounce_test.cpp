@@ -0,0 +1,122 @@
+// PortBounce on bouncing, clicking and holding buttons, wired like the TX: pin 2 active low, pin 3 active high
+
+#include <Arduino.h>
+#include <Bounce2.h>
+#include <PortBounce.h>
+
+#include "test.h"
+
+static PortBounce buttons;
+static Bounce cruise;
+static int pressed[8], released[8], longs[8], doubles[8], bounceFell;
+static unsigned long lastPress;
+
+// Sets the pin levels and runs the debouncers every ms for the given time
+static void run(unsigned long ms, uint8_t pin2, uint8_t pin3)
+{
+    hostSetPin(2, pin2);
+    hostSetPin(3, pin3);
+    for (; ms; ms--) {
+        delay(1);
+        if (buttons.update()) {
+            for (uint8_t bit = 2; bit <= 3; bit++) {
+                pressed[bit] += buttons.pressed(bit);
+                released[bit] += buttons.released(bit);
+                longs[bit] += buttons.longPress(bit);
+                doubles[bit] += buttons.doubleClick(bit);
+            }
+            if (buttons.pressed(2)) lastPress = millis();
+        }
+        if (cruise.update() && cruise.fell()) bounceFell++;
+    }
+}
+
+static void clear()
+{
+    memset(pressed, 0, sizeof(pressed));
+    memset(released, 0, sizeof(released));
+    memset(longs, 0, sizeof(longs));
+    memset(doubles, 0, sizeof(doubles));
+    bounceFell = 0;
+}
+
+int main()
+{
+    hostReset();
+    pinMode(2, INPUT_PULLUP);
+    pinMode(3, INPUT);
+    hostSetPin(3, LOW);
+    buttons.attach(&PIND, _BV(2) | _BV(3), _BV(3));
+    buttons.timing(4095, 300);
+    cruise.attach(2);
+    cruise.interval(20);
+    CHECK(!buttons.read(2));
+    CHECK(!buttons.read(3));
+
+    // A contact bouncing for 12ms gives one press, at most 20ms after it settled
+    run(100, HIGH, LOW);
+    for (int i = 0; i < 4; i++) {
+        run(1, LOW, LOW);
+        run(2, HIGH, LOW);
+    }
+    unsigned long settled = millis();
+    run(100, LOW, LOW);
+    CHECK_EQ(pressed[2], 1);
+    CHECK(buttons.read(2));
+    CHECK(lastPress > settled && lastPress <= settled + 20); // at most 4 samples
+    CHECK_EQ(bounceFell, 1); // Bounce2 sees the same single press
+
+    // A glitch shorter than 4 samples is ignored
+    run(8, HIGH, LOW);
+    run(100, LOW, LOW);
+    CHECK_EQ(released[2], 0);
+    CHECK_EQ(pressed[2], 1);
+
+    // Two short clicks are a double click
+    run(500, HIGH, LOW);
+    clear();
+    run(60, LOW, LOW);
+    run(60, HIGH, LOW);
+    run(60, LOW, LOW);
+    run(100, HIGH, LOW);
+    CHECK_EQ(pressed[2], 2);
+    CHECK_EQ(released[2], 2);
+    CHECK_EQ(doubles[2], 1);
+
+    // A third click right after it starts no new double click
+    run(60, LOW, LOW);
+    run(100, HIGH, LOW);
+    CHECK_EQ(doubles[2], 1);
+
+    // Clicks further apart are not
+    clear();
+    run(500, HIGH, LOW);
+    run(60, LOW, LOW);
+    run(400, HIGH, LOW);
+    run(60, LOW, LOW);
+    run(100, HIGH, LOW);
+    CHECK_EQ(doubles[2], 0);
+
+    // Holding the settings button gives one long press after time_settings, the other button is untouched
+    clear();
+    run(4000, HIGH, HIGH);
+    CHECK_EQ(pressed[3], 1);
+    CHECK_EQ(longs[3], 0);
+    run(200, HIGH, HIGH);
+    CHECK_EQ(longs[3], 1);
+    run(3000, HIGH, HIGH);
+    CHECK_EQ(longs[3], 1);
+    run(100, HIGH, LOW);
+    CHECK_EQ(released[3], 1);
+    CHECK_EQ(doubles[3], 0);
+    CHECK_EQ(pressed[2] + released[2], 0);
+
+    // Both at once are debounced together
+    clear();
+    run(100, LOW, HIGH);
+    CHECK_EQ(pressed[2], 1);
+    CHECK_EQ(pressed[3], 1);
+    CHECK(buttons.read(2) && buttons.read(3));
+
+    return TEST_RESULT;
+}
@@ -0,0 +1,154 @@
+// SDLog on a card directory: the file name after the highest log, one erased extent written in place,
+// one card write per sector, the log going on in the next file and a read back
+
+#include <Arduino.h>
+#include <SD.h>
+#include <SDLog.h>
+
+#include "test.h"
+
+struct Sample {
+    uint16_t count;
+    int32_t value;
+} __attribute__((packed));
+
+static const logField fields[] PROGMEM = {
+    {"count", LOG_U16, offsetof(Sample, count), 1},
+    {"value", LOG_I32, offsetof(Sample, value), 0.01},
+};
+
+static long fileSize(const char *name)
+{
+    File f = SD.open(name);
+    return f ? (long)f.size() : -1;
+}
+
+static void touch(const char *name)
+{
+    File f = SD.open(name, FILE_WRITE);
+    f.write((const uint8_t *)"x", 1);
+}
+
+static const char *logName(int number)
+{
+    static char name[] = "LOG000.BIN";
+    name[3] = '0' + number / 100;
+    name[4] = '0' + number / 10 % 10;
+    name[5] = '0' + number % 10;
+    return name;
+}
+
+static void logSamples(SDLog *logger, int samples)
+{
+    logHeader header;
+
+    memset(&header, 0, sizeof(header));
+    header.fields = sizeof(fields) / sizeof(logField);
+    logger->writeHeader(&header, fields);
+    for (int i = 0; i < samples; i++) {
+        Sample s = {(uint16_t)i, i * 37 - 5000};
+        hostAdvance(100000);
+        logger->writeSample(&s);
+    }
+    logger->sync();
+}
+
+// Only here, its <fcntl.h> defines O_CREAT and the other open flags of SD.h as macros
+#include "logreader.h"
+
+// Reads the samples of a log, counting on from n, returns the next count or -1
+static int readSamples(const char *name, int n, size_t *used)
+{
+    logReader reader;
+    const uint8_t *payload;
+
+    if (logOpen(&reader, SD.hostPath(name))) return -1;
+    while ((payload = logNextSample(&reader))) {
+        Sample s;
+        memcpy(&s, payload, sizeof(s));
+        CHECK_EQ(s.count, n);
+        CHECK_EQ(s.value, n * 37 - 5000);
+        n++;
+    }
+    CHECK_EQ(reader.badFrames, 0);
+    CHECK_EQ(reader.lostFrames, 0);
+    CHECK_EQ(reader.unresolved, 0);
+    CHECK_EQ(reader.skipped, 0); // no old data of the card in the log
+    if (used) {
+        *used = reader.size;
+        while (*used && reader.data[*used - 1] == 0xFF)
+            (*used)--;
+    }
+    logClose(&reader);
+    return n;
+}
+
+int main()
+{
+    char dir[] = "/tmp/sdlogXXXXXX";
+    const int samples = 3000;
+    SDLog logger;
+
+    hostReset();
+    if (!mkdtemp(dir)) return 1;
+    SD.hostRoot(dir);
+    SD.begin();
+    touch("LOG007.BIN");
+    touch("LOG012.TXT");
+    touch("README.TXT");
+
+    // The sector buffer is the block cache of the SD library
+    CHECK(sizeof(SDLog) < SDLOG_SECTOR);
+
+    // The log after the highest LOGnnn.BIN, the whole extent at once
+    CHECK(logger.begin(64));
+    CHECK_EQ(fileSize("LOG008.BIN"), 64 * SDLOG_SECTOR);
+
+    SD.hostBlockUs = 1500;
+    SD.hostWritten = 0;
+    logSamples(&logger, samples);
+
+    // Only sectors of the log were written, no FAT or directory blocks, each one with a single
+    // block write: the full ones once, the open one again at every sync (5 s)
+    CHECK_EQ(SD.hostWritten, logger.sectorWrites() * SDLOG_SECTOR);
+    CHECK_EQ(logger.maxLatency(), 1500);
+    CHECK_EQ(fileSize("LOG008.BIN"), 64 * SDLOG_SECTOR);
+
+    // Every sector went to its place, so the log reads back from the start
+    size_t used = 0;
+    CHECK_EQ(readSamples("LOG008.BIN", 0, &used), samples);
+    uint32_t sectors = used / SDLOG_SECTOR, syncs = samples / 50 + 1;
+    CHECK(logger.sectorWrites() >= sectors && logger.sectorWrites() <= sectors + syncs);
+    CHECK(sectors < 64);
+
+    // A full extent: the log goes on in the next files, each with the header and a key frame
+    SDLog small;
+    CHECK(small.begin(SDLOG_EXTENT_MIN));
+    CHECK_EQ(fileSize("LOG009.BIN"), SDLOG_EXTENT_MIN * SDLOG_SECTOR);
+    logSamples(&small, samples);
+    int n = 0, files = 0;
+    for (; n < samples && files < 100; files++) {
+        CHECK_EQ(fileSize(logName(9 + files)), SDLOG_EXTENT_MIN * SDLOG_SECTOR);
+        int next = readSamples(logName(9 + files), n, 0);
+        CHECK(next > n);
+        if (next <= n) break;
+        n = next;
+    }
+    CHECK_EQ(n, samples);
+    CHECK(files > 1);
+
+    // The next begin() takes the number after them
+    SDLog next;
+    CHECK(next.begin(4));
+    CHECK_EQ(fileSize(logName(9 + files)), 4 * SDLOG_SECTOR);
+
+    // A card without room for the extent gets the largest half that fits, or no log
+    SD.hostFreeRun = 40;
+    SDLog half;
+    CHECK(half.begin(64));
+    CHECK_EQ(fileSize(logName(10 + files)), 32 * SDLOG_SECTOR);
+    SD.hostFreeRun = SDLOG_EXTENT_MIN - 1;
+    SDLog none;
+    CHECK(!none.begin(64));
+    return TEST_RESULT;
+}
@@ -0,0 +1,181 @@
+// Checks the fake hardware of the host build itself, the other tests rely on it
+
+#include <Arduino.h>
+#include <EEPROM.h>
+#include <SD.h>
+#include <SPI.h>
+#include <pins_arduino.h>
+#include <unistd.h>
+
+#include "test.h"
+
+static uint8_t lastSpi;
+static uint8_t spiEcho(uint8_t b)
+{
+    lastSpi = b;
+    return b ^ 0xFF;
+}
+
+struct Echo : HostSerialDevice {
+    void hostWrite(HardwareSerial *port, const uint8_t *data, size_t len) { port->hostReceive(data, len); }
+};
+
+int main()
+{
+    hostReset();
+
+    // clock
+    CHECK_EQ(millis(), 0);
+    delay(5);
+    CHECK_EQ(millis(), 5);
+    CHECK_EQ(micros(), 5000);
+    hostAdvance(1500);
+    CHECK_EQ(millis(), 6);
+    hostTickPerCall = 10;
+    unsigned long t = micros();
+    CHECK_EQ(micros() - t, 10);
+    hostTickPerCall = 0;
+
+    // pins, PIND follows the host levels, PORTD follows digitalWrite()
+    pinMode(2, INPUT_PULLUP);
+    CHECK_EQ(digitalRead(2), HIGH);
+    hostSetPin(2, LOW);
+    CHECK_EQ(digitalRead(2), LOW);
+    CHECK_EQ(PIND & _BV(2), 0);
+    pinMode(9, OUTPUT);
+    digitalWrite(9, HIGH);
+    CHECK(PORTB & _BV(1));
+    CHECK_EQ(*portOutputRegister(digitalPinToPort(9)) & digitalPinToBitMask(9), _BV(1));
+    hostSetAnalog(A3, 512);
+    CHECK_EQ(analogRead(A3), 512);
+    CHECK_EQ(analogRead(3), 512);
+
+    // SPI, SPDR and transfer() go to the same hook
+    hostSpiHook = spiEcho;
+    SPDR = 0x5A;
+    CHECK_EQ(lastSpi, 0x5A);
+    CHECK_EQ((uint8_t)SPDR, 0xA5);
+    CHECK_EQ(SPI.transfer(0x0F), 0xF0);
+    CHECK_EQ(hostSpiBytes, 2);
+    CHECK(SPSR & _BV(SPIF));
+    SPI.beginTransaction(SPISettings(8000000, MSBFIRST, SPI_MODE0));
+    SPI.endTransaction();
+    CHECK_EQ(hostSpiTransactions, 1);
+    CHECK_EQ(SPCR & 0x03, 0); // 8 MHz of 16 MHz is SPI_CLOCK_DIV2
+    CHECK(SPSR & _BV(SPI2X));
+
+    // With a CPU clock SPI bytes take time, 2 us at 8 MHz and DIV2, 16 us at DIV16
+    hostCpuHz = 8000000;
+    uint32_t start = micros();
+    SPI.beginTransaction(SPISettings(4000000, MSBFIRST, SPI_MODE0));
+    SPI.transfer(0);
+    CHECK_EQ(micros() - start, 2);
+    SPI.beginTransaction(SPISettings(500000, MSBFIRST, SPI_MODE0));
+    SPDR = 0;
+    CHECK_EQ(micros() - start, 2 + 16);
+    SPI.setClockDivider(SPI_CLOCK_DIV128);
+    for (int i = 0; i < 10; i++)
+        SPDR = 0;
+    CHECK_EQ(micros() - start, 2 + 16 + 1280);
+    hostCpuHz = 0;
+
+    // Serial, received bytes take their wire time at the set baud rate
+    Echo echo;
+    Serial.begin(115200);
+    Serial.hostAttach(&echo);
+    Serial.write((const uint8_t *)"abc", 3);
+    CHECK_EQ(Serial.available(), 0);
+    hostAdvance(87 * 3);
+    CHECK_EQ(Serial.available(), 3);
+    CHECK_EQ(Serial.read(), 'a');
+    uint8_t big[100] = {0};
+    Serial.write(big, sizeof(big));
+    hostAdvance(100000);
+    CHECK_EQ(Serial.available(), SERIAL_RX_BUFFER_SIZE);
+    CHECK_EQ(Serial.hostOverruns(), 100 + 2 - SERIAL_RX_BUFFER_SIZE);
+    Serial.hostAttach(0);
+    Serial.hostClear();
+    Serial.print(-12);
+    Serial.print(' ');
+    Serial.print(3.14159, 3);
+    Serial.print(' ');
+    Serial.println(255, HEX);
+    CHECK(!strcmp(Serial.hostOutput(), "-12 3.142 FF\r\n"));
+
+    // EEPROM
+    CHECK_EQ(EEPROM.read(100), 0xFF);
+    EEPROM.update(100, 7);
+    EEPROM.update(100, 7);
+    CHECK_EQ(EEPROM.writes[100], 1);
+    uint32_t v = 0x12345678, w = 0;
+    EEPROM.put(200, v);
+    CHECK_EQ(EEPROM.get(200, w), 0x12345678);
+
+    // SD, FILE_WRITE appends like the Arduino library, O_WRITE without O_APPEND writes at the seek position
+    char dir[] = "/tmp/shimsdXXXXXX";
+    CHECK(mkdtemp(dir));
+    SD.hostRoot(dir);
+    CHECK(SD.begin());
+    File f = SD.open("A.BIN", FILE_WRITE);
+    CHECK(f);
+    f.write((const uint8_t *)"1234", 4);
+    f.seek(0);
+    f.write((const uint8_t *)"x", 1);
+    CHECK_EQ(f.size(), 5);
+    f.close();
+    f = SD.open("A.BIN", O_READ | O_WRITE);
+    f.seek(0);
+    f.write((const uint8_t *)"y", 1);
+    CHECK_EQ(f.size(), 5);
+    f.seek(0);
+    CHECK_EQ(f.read(), 'y');
+    SD.hostBlockUs = 1000; // blocks touched by a write, the directory entry on flush()
+    uint8_t block[600] = {0};
+    start = micros();
+    f.seek(4);
+    f.write(block, sizeof(block));
+    CHECK_EQ(micros() - start, 2000);
+    f.flush();
+    CHECK_EQ(micros() - start, 3000);
+    SD.hostBlockUs = 0;
+    f.close();
+    CHECK(SD.exists("A.BIN"));
+    CHECK(!SD.exists("B.BIN"));
+    File root = SD.open("/");
+    CHECK(root.isDirectory());
+    File e = root.openNextFile();
+    CHECK(e && !strcmp(e.name(), "A.BIN"));
+    e.close();
+    root.close();
+    SD.remove("A.BIN");
+
+    // Raw blocks of a contiguous file, it holds old data until it is erased
+    SdVolume volume;
+    SdFile dirFile, file;
+    uint32_t first, last;
+    uint8_t data[512];
+    CHECK(volume.init(SdVolume::sdCard()));
+    CHECK(dirFile.openRoot(&volume));
+    CHECK(file.createContiguous(&dirFile, "C.BIN", 3 * 512));
+    CHECK(!SdFile().createContiguous(&dirFile, "C.BIN", 512));
+    CHECK(file.contiguousRange(&first, &last));
+    CHECK_EQ(last - first, 2);
+    Sd2Card *card = SdVolume::sdCard();
+    CHECK(card->readBlock(first, data) && data[0] != 0xFF);
+    CHECK(card->erase(first, last));
+    CHECK(card->readBlock(last, data) && data[511] == 0xFF);
+    memset(data, 7, sizeof(data));
+    CHECK(card->writeBlock(first + 1, data));
+    CHECK(!card->writeBlock(last + 1, data)); // not part of a file
+    file.close();
+    dirFile.close();
+    File c = SD.open("C.BIN");
+    CHECK_EQ(c.size(), 3 * 512);
+    c.seek(512);
+    CHECK_EQ(c.read(), 7);
+    c.close();
+    SD.remove("C.BIN");
+    rmdir(dir);
+
+    return TEST_RESULT;
+}
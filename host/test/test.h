@@ -0,0 +1,36 @@
+/*
+  test.h - the checks of the host tests
+
+  Every test is one executable, ctest runs it and reads the exit code. A
+  failed CHECK prints the file, line and expression and the test goes on, so
+  one run shows all failures. Return TEST_RESULT from main().
+*/
+
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+#include <stdio.h>
+
+static int testFailures;
+
+#define CHECK(cond)                                                             \
+    do {                                                                        \
+        if (!(cond)) {                                                          \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond);     \
+            testFailures++;                                                     \
+        }                                                                       \
+    } while (0)
+
+#define CHECK_EQ(a, b)                                                          \
+    do {                                                                        \
+        long long va = (long long)(a), vb = (long long)(b);                     \
+        if (va != vb) {                                                         \
+            printf("%s:%d: CHECK_EQ(%s, %s) failed, %lld != %lld\n", __FILE__, \
+                   __LINE__, #a, #b, va, vb);                                   \
+            testFailures++;                                                     \
+        }                                                                       \
+    } while (0)
+
+#define TEST_RESULT (testFailures ? (printf("%d checks failed\n", testFailures), 1) : 0)
+
+#endif
@@ -0,0 +1,170 @@
+// TFT_ST7735 drawn into the ST7735 model, compared with golden images and with itself
+//
+// The golden PPM files are in test/golden. After an intended change of the
+// drawing code run the test with GOLDEN_UPDATE=1 to write them again and look
+// at them before committing. A mismatch leaves <name>.out.ppm in the build
+// directory.
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <TFT_ST7735.h>
+#include <ST7735Model.h>
+#include <limits.h>
+#include <string>
+#include <vector>
+
+#include "test.h"
+
+static TFT_ST7735 tft;
+static ST7735Model panel(TFT_CS, TFT_DC);
+
+static std::vector<uint16_t> snapshot()
+{
+    std::vector<uint16_t> image;
+    for (int y = 0; y < ST7735Model::height; y++)
+        for (int x = 0; x < ST7735Model::width; x++)
+            image.push_back(panel.pixel(x, y));
+    return image;
+}
+
+static void golden(const char *name)
+{
+    std::string path = std::string(HOST_GOLDEN_DIR "/") + name + ".ppm";
+
+    if (getenv("GOLDEN_UPDATE")) {
+        CHECK(panel.writePPM(path.c_str()));
+        return;
+    }
+    long diff = panel.comparePPM(path.c_str());
+    if (diff) {
+        printf("%s: %ld pixels differ\n", name, diff);
+        panel.writePPM((std::string(name) + ".out.ppm").c_str());
+    }
+    CHECK_EQ(diff, 0);
+}
+
+// Labels and values like the TX dashboard, in the fonts it uses
+static void drawText()
+{
+    tft.fillScreen(TFT_BLACK);
+    tft.setTextColor(TFT_WHITE, TFT_BLACK);
+    tft.setTextSize(1);
+    tft.drawString((char *)"km/h", 90, 10, 2);
+    tft.drawString((char *)"Wh/km", 4, 60, 2);
+    tft.setTextColor(TFT_YELLOW, TFT_BLACK);
+    tft.drawFloat(12.5, 1, 4, 76, 4);
+    tft.setTextColor(TFT_WHITE, TFT_BLUE);
+    tft.setTextSize(2);
+    tft.drawString((char *)"EMTB", 4, 110, 2);
+    tft.drawNumber(42, 70, 110, 2);
+    tft.setTextColor(TFT_GREEN, TFT_BLACK);
+    tft.drawRightNumber(37, 124, 20, 4);
+}
+
+static void drawShapes()
+{
+    tft.fillScreen(TFT_NAVY);
+    tft.drawRect(4, 4, 120, 152, TFT_WHITE);
+    tft.fillRect(10, 10, 30, 20, TFT_RED);
+    tft.fillRect(44, 10, 30, 20, TFT_GREEN);
+    tft.fillRect(78, 10, 30, 20, TFT_BLUE);
+    tft.drawFastHLine(10, 40, 100, TFT_YELLOW);
+    tft.drawFastVLine(64, 44, 50, TFT_CYAN);
+    tft.drawLine(10, 50, 120, 100, TFT_MAGENTA);
+    tft.drawCircle(40, 120, 20, TFT_ORANGE);
+    tft.fillCircle(90, 120, 15, TFT_WHITE);
+}
+
+int main()
+{
+    hostReset();
+    panel.attach();
+    tft.init();
+    tft.setRotation(0);
+
+    drawText();
+    golden("tft_text");
+    drawShapes();
+    golden("tft_shapes");
+
+    // A number slot after a run of updates looks like a slot drawn once with the last value
+    numberslot slot;
+    tft.fillScreen(TFT_BLACK);
+    tft.setTextColor(TFT_WHITE, TFT_BLACK);
+    tft.setTextSize(1);
+    tft.initNumberSlot(&slot, 100, 40, 4, 5, 1);
+    const long values[] = {0, 5, 123, -45, 9999, 1000, 7, -7, 870};
+    for (unsigned i = 0; i < sizeof(values) / sizeof(values[0]); i++)
+        tft.drawSlotNumber(&slot, values[i]);
+    std::vector<uint16_t> updated = snapshot();
+    tft.fillScreen(TFT_BLACK);
+    tft.initNumberSlot(&slot, 100, 40, 4, 5, 1);
+    tft.drawSlotNumber(&slot, 870);
+    CHECK(snapshot() == updated);
+    golden("tft_slot");
+
+    // LONG_MIN has no positive long, its cells are those of another value with the same last digits
+    tft.fillScreen(TFT_BLACK);
+    tft.initNumberSlot(&slot, 100, 40, 4, 5, 1);
+    tft.drawSlotNumber(&slot, LONG_MIN);
+    std::vector<uint16_t> longMin = snapshot();
+    tft.fillScreen(TFT_BLACK);
+    tft.initNumberSlot(&slot, 100, 40, 4, 5, 1);
+    tft.drawSlotNumber(&slot, -775808);
+    CHECK(snapshot() == longMin);
+
+    // A slot painted in bands of glyph rows looks like the one drawn at once, every call
+    // sends about the pixels it was given, the number changing in between restarts its cell
+    const uint16_t budget = 256;
+    for (int font = 2; font <= 4; font += 2) {
+        for (uint8_t size = 1; size <= 2; size++) {
+            tft.fillScreen(TFT_BLACK);
+            tft.setTextColor(TFT_WHITE, TFT_BLACK);
+            tft.setTextSize(size);
+            tft.initNumberSlot(&slot, 120, 30, font, 5, 1);
+            tft.drawSlotNumber(&slot, 1234);
+            tft.drawSlotNumber(&slot, -870);
+            std::vector<uint16_t> drawn = snapshot();
+
+            tft.fillScreen(TFT_BLACK);
+            tft.initNumberSlot(&slot, 120, 30, font, 5, 1);
+            tft.drawSlotNumber(&slot, 1234);
+            int calls = 0;
+            unsigned long worst = 0;
+            for (long v = 5678; calls < 1000; calls++) {
+                if (calls == 1) v = -870;
+                panel.data = 0;
+                bool done = tft.paintSlotNumber(&slot, v, budget);
+                worst = max(worst, panel.data);
+                if (done) break;
+            }
+            CHECK(snapshot() == drawn);
+            CHECK(calls > 1);
+            CHECK(worst <= 2 * (budget + 56) + 32); // one glyph row over at most (font 4 x2), and the windows
+        }
+    }
+
+    // Opaque scaled glyphs in one window look like the per pixel path on a cleared background
+    for (int font = 2; font <= 4; font += 2) {
+        tft.fillScreen(TFT_BLACK);
+        tft.setTextSize(2);
+        tft.setTextColor(TFT_WHITE, TFT_BLACK);
+        panel.windows = 0;
+        int x = 0;
+        for (char c = '0'; c <= '5'; c++)
+            x += tft.drawChar(c, x, 30, font);
+        std::vector<uint16_t> block = snapshot();
+        unsigned long blockWindows = panel.windows;
+
+        tft.fillScreen(TFT_BLACK);
+        panel.windows = 0;
+        tft.setTextColor(TFT_WHITE, TFT_WHITE);
+        x = 0;
+        for (char c = '0'; c <= '5'; c++)
+            x += tft.drawChar(c, x, 30, font);
+        CHECK(snapshot() == block);
+        CHECK(panel.windows > blockWindows);
+    }
+
+    return TEST_RESULT;
+}
@@ -0,0 +1,77 @@
+// The SPI_STATS counters of TFT_ST7735 against the commands and data bytes the ST7735 model receives
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <TFT_ST7735.h>
+#include <ST7735Model.h>
+
+#include "test.h"
+
+static TFT_ST7735 tft;
+static ST7735Model panel(TFT_CS, TFT_DC);
+
+static void expect(const char *what)
+{
+    if (tft.spiCommands() != panel.commands || tft.spiBytes() != panel.data)
+        printf("%s: counted %lu commands %lu bytes, sent %lu commands %lu bytes\n", what, (unsigned long)tft.spiCommands(),
+               (unsigned long)tft.spiBytes(), panel.commands, panel.data);
+    CHECK(panel.data > 0);
+    CHECK_EQ(tft.spiCommands(), panel.commands);
+    CHECK_EQ(tft.spiBytes(), panel.data);
+    tft.resetSpiStats();
+    panel.commands = panel.data = 0;
+}
+
+int main()
+{
+    numberslot slot;
+
+    hostReset();
+    panel.attach();
+    tft.init();
+    tft.setRotation(0);
+    expect("init");
+
+    tft.fillScreen(TFT_BLACK);
+    expect("fillScreen");
+    tft.drawPixel(3, 4, TFT_RED);
+    expect("drawPixel");
+    tft.drawFastHLine(0, 10, 50, TFT_WHITE);
+    tft.drawFastVLine(5, 0, 50, TFT_WHITE);
+    expect("fast lines");
+    tft.drawLine(0, 0, 100, 37, TFT_GREEN);
+    expect("drawLine");
+    tft.drawRect(10, 10, 40, 30, TFT_BLUE);
+    tft.fillRect(12, 12, 36, 26, TFT_RED);
+    expect("rectangles");
+    tft.drawCircle(60, 60, 20, TFT_YELLOW);
+    tft.fillCircle(60, 100, 10, TFT_YELLOW);
+    expect("circles");
+
+    for (uint8_t size = 1; size <= 2; size++) {
+        tft.setTextSize(size);
+        tft.setTextColor(TFT_WHITE, TFT_BLACK);
+        tft.drawString((char *)"Wh/km 12.5", 0, 20, 2);
+        expect("font 2 opaque");
+        tft.drawNumber(1234, 0, 60, 4);
+        expect("font 4 opaque");
+        tft.setTextColor(TFT_WHITE, TFT_WHITE);
+        tft.drawString((char *)"Wh/km 12.5", 0, 20, 2);
+        expect("font 2 transparent");
+        tft.drawNumber(1234, 0, 60, 4);
+        expect("font 4 transparent");
+    }
+
+    tft.setTextSize(1);
+    tft.setTextColor(TFT_WHITE, TFT_BLACK);
+    tft.setTextPadding(60);
+    tft.drawFloat(3.25, 2, 0, 100, 4);
+    expect("padded drawFloat");
+    tft.setTextPadding(0);
+    tft.initNumberSlot(&slot, 100, 130, 4, 5, 1);
+    tft.drawSlotNumber(&slot, 1234);
+    tft.drawSlotNumber(&slot, 1239);
+    expect("number slot");
+
+    return TEST_RESULT;
+}
@@ -0,0 +1,75 @@
+// VescUartControl against the VESC model on the host Serial: values, current and rpm commands, timeout
+
+#include <Arduino.h>
+#include <VescUart.h>
+
+#include "VescModel.h"
+#include "test.h"
+
+static VescModel vesc;
+
+// Commands every 20ms like the RX for ms, then the values
+static bool drive(void (*command)(int32_t), int32_t value, uint32_t ms, bldcMeasure *values)
+{
+    for (uint32_t t = 0; t < ms; t += 20) {
+        command(value);
+        delay(20);
+    }
+    VescUartRequestValues();
+    delay(10); // 61 bytes at 115200 baud take 5.3ms
+    return VescUartGetValue(*values);
+}
+
+int main()
+{
+    bldcMeasure values;
+
+    hostReset();
+    Serial.begin(115200);
+    vesc.attach(Serial);
+
+    // Standing, full battery
+    delay(200);
+    CHECK(VescUartRequestValues());
+    delay(10);
+    CHECK(VescUartGetValue(values));
+    CHECK_EQ(values.rpm, 0);
+    CHECK_EQ(values.v_in, 420);
+    CHECK_EQ(vesc.answers, 1);
+
+    // 10A accelerate the board, the battery sags with the input current
+    CHECK(drive(VescUartSetCurrentMilli, 10000, 2000, &values));
+    CHECK_EQ(values.current_motor, 1000);
+    CHECK(values.rpm > 3000);
+    CHECK(values.current_in > 0 && values.current_in < 1000);
+    CHECK(values.v_in < 420);
+    CHECK(values.amp_hours > 0);
+    CHECK(values.tachometerAbs > 0);
+    CHECK_EQ(vesc.vesc.mode, VESC_CURRENT);
+
+    // The speed loop holds 5000 erpm within the error of its P gain against drag and load
+    CHECK(drive(VescUartSetRPM, 5000, 3000, &values));
+    CHECK(values.rpm > 4750 && values.rpm <= 5000);
+    CHECK_EQ(vesc.vesc.mode, VESC_RPM);
+
+    // Braking stops the board without turning it backwards
+    CHECK(drive(VescUartSetCurrentBrakeMilli, 20000, 3000, &values));
+    CHECK_EQ(values.rpm, 0);
+    CHECK(vesc.maxGapMs <= 40); // one command every 20ms, the requests in between
+
+    // Without commands the VESC releases the motor after 1s
+    VescUartSetCurrentMilli(10000);
+    delay(1100);
+    vesc.update();
+    CHECK_EQ(vesc.vesc.mode, VESC_OFF);
+
+    // A broken frame is counted and ignored
+    unsigned long commands = vesc.commands;
+    uint8_t frame[] = {2, 5, COMM_SET_CURRENT, 0, 0, 0x27, 0x10, 0, 0, 3};
+    Serial.write(frame, sizeof(frame));
+    CHECK_EQ(vesc.badFrames, 1);
+    CHECK_EQ(vesc.commands, commands);
+    CHECK_EQ(Serial.hostOverruns(), 0);
+
+    return TEST_RESULT;
+}
@@ -0,0 +1,92 @@
+// VescUartControl on the host Serial: the frames it writes and a COMM_GET_VALUES reply it reads
+
+#include <Arduino.h>
+#include <VescUart.h>
+#include <buffer.h>
+#include <crc.h>
+
+#include "test.h"
+
+// COMM_GET_VALUES reply of a VESC 2.x, 56 bytes with the fault code
+static int valuesReply(uint8_t *payload)
+{
+    int32_t ind = 0;
+    payload[ind++] = COMM_GET_VALUES;
+    for (int i = 0; i < 7; i++)
+        buffer_append_int16(payload, 250 + i, &ind); // temperatures [0.1C]
+    buffer_append_int32(payload, -1234, &ind);       // current_motor [0.01A]
+    buffer_append_int32(payload, 4321, &ind);        // current_in [0.01A]
+    buffer_append_int16(payload, 456, &ind);         // duty_now [0.1%]
+    buffer_append_int32(payload, 21000, &ind);       // rpm [erpm]
+    buffer_append_int16(payload, 412, &ind);         // v_in [0.1V]
+    buffer_append_int32(payload, 98765, &ind);       // amp_hours [0.1mAh]
+    buffer_append_int32(payload, 1234, &ind);        // amp_hours_charged [0.1mAh]
+    buffer_append_int32(payload, 1, &ind);           // watt_hours
+    buffer_append_int32(payload, 2, &ind);           // watt_hours_charged
+    buffer_append_int32(payload, 3, &ind);           // tachometer
+    buffer_append_int32(payload, 777777, &ind);      // tachometerAbs
+    payload[ind++] = 0;                              // fault code
+    return ind;
+}
+
+int main()
+{
+    uint8_t payload[64];
+    bldcMeasure values;
+
+    hostReset();
+    Serial.begin(115200);
+
+    // COMM_SET_CURRENT with 12.5A
+    VescUartSetCurrentMilli(12500);
+    const uint8_t *out = (const uint8_t *)Serial.hostOutput();
+    CHECK_EQ(Serial.hostOutputLength(), 10);
+    CHECK_EQ(out[0], 2);
+    CHECK_EQ(out[1], 5);
+    CHECK_EQ(out[2], COMM_SET_CURRENT);
+    int32_t ind = 3;
+    CHECK_EQ(buffer_get_int32(out, &ind), 12500);
+    CHECK_EQ((out[7] << 8) | out[8], crc16((uint8_t *)out + 2, 5));
+    CHECK_EQ(out[9], 3);
+
+    // Requests at most every 100ms
+    Serial.hostClear();
+    delay(200);
+    CHECK(VescUartRequestValues());
+    CHECK(!VescUartRequestValues());
+    delay(101);
+    CHECK(VescUartRequestValues());
+    CHECK_EQ(Serial.hostOutputLength(), 12);
+
+    // The reply is read once all of it passed the wire
+    int len = valuesReply(payload);
+    CHECK_EQ(len, 56);
+    Serial.hostClear();
+    Serial.hostAttach(0);
+    PackSendPayload(payload, len);
+    uint8_t frame[64];
+    size_t frameLen = Serial.hostOutputLength();
+    memcpy(frame, Serial.hostOutput(), frameLen);
+    Serial.hostClear();
+    Serial.hostReceive(frame, frameLen);
+    CHECK(!VescUartGetValue(values)); // nothing there yet
+    delay(10);                        // 61 bytes at 115200 baud take 5.3ms
+    CHECK(VescUartGetValue(values));
+    CHECK_EQ(values.current_motor, -1234);
+    CHECK_EQ(values.current_in, 4321);
+    CHECK_EQ(values.duty_now, 456);
+    CHECK_EQ(values.rpm, 21000);
+    CHECK_EQ(values.v_in, 412);
+    CHECK_EQ(values.amp_hours, 98765);
+    CHECK_EQ(values.amp_hours_charged, 1234);
+    CHECK_EQ(values.tachometerAbs, 777777);
+    CHECK_EQ(Serial.hostOverruns(), 0);
+
+    // A broken CRC is dropped
+    frame[10] ^= 1;
+    Serial.hostReceive(frame, frameLen);
+    delay(10);
+    CHECK(!VescUartGetValue(values));
+
+    return TEST_RESULT;
+}
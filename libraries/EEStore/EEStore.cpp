@@ -0,0 +1,116 @@
+// Please read EEStore.h for information about the EEPROM layout
+
+#include "Arduino.h"
+#include <EEPROM.h>
+#ifdef __AVR__
+#include <util/crc16.h>
+#else
+// The C version of avr-libc's documentation for other targets
+static inline uint16_t _crc_xmodem_update(uint16_t crc, uint8_t data)
+{
+    crc ^= (uint16_t)data << 8;
+    for (uint8_t i = 0; i < 8; i++)
+        crc = crc & 0x8000 ? (crc << 1) ^ 0x1021 : crc << 1;
+    return crc;
+}
+#endif
+#include "EEStore.h"
+
+EEStore::EEStore(uint16_t base, uint8_t slots)
+    : base(base)
+    , slots(slots)
+    , slot(slots - 1)
+    , seq(0)
+    , size(0)
+    , version(0)
+    , data(0)
+{}
+
+bool EEStore::begin(void *data, uint8_t size, const void *defaults, uint8_t version)
+{
+    bool found = false;
+    uint8_t best = 0;
+
+    if (size > EESTORE_MAX) size = EESTORE_MAX;
+    this->data = (uint8_t *)data;
+    this->size = size;
+    this->version = version;
+
+    // Newest valid record, seq compared modulo 256
+    for (uint8_t i = 0; i < slots; i++) {
+        if (!valid(i)) continue;
+        uint8_t s = EEPROM.read(address(i) + 1);
+        if (!found || (int8_t)(s - best) > 0) {
+            found = true;
+            best = s;
+            slot = i;
+        }
+    }
+
+    if (found) {
+        seq = best;
+        for (uint8_t i = 0; i < size; i++)
+            saved[i] = EEPROM.read(address(slot) + 2 + i);
+    } else {
+        slot = slots - 1; // the first save() goes to slot 0
+        seq = 0;
+        memcpy_P(saved, defaults, size);
+    }
+    memcpy(this->data, saved, size);
+    return found;
+}
+
+bool EEStore::changed(uint8_t offset, uint8_t len)
+{
+    return memcmp(data + offset, saved + offset, len) != 0;
+}
+
+bool EEStore::dirty()
+{
+    return changed(0, size);
+}
+
+bool EEStore::save()
+{
+    uint16_t addr, crc;
+
+    if (!dirty()) return false;
+
+    if (++slot >= slots) slot = 0;
+    seq++;
+    addr = address(slot);
+    crc = _crc_xmodem_update(0, version);
+    crc = _crc_xmodem_update(crc, seq);
+    EEPROM.update(addr++, version);
+    EEPROM.update(addr++, seq);
+    for (uint8_t i = 0; i < size; i++) {
+        crc = _crc_xmodem_update(crc, data[i]);
+        EEPROM.update(addr++, data[i]);
+    }
+    EEPROM.update(addr++, crc);
+    EEPROM.update(addr, crc >> 8);
+
+    memcpy(saved, data, size);
+    return true;
+}
+
+void EEStore::revert()
+{
+    memcpy(data, saved, size);
+}
+
+uint16_t EEStore::address(uint8_t slot)
+{
+    return base + slot * (size + 4);
+}
+
+bool EEStore::valid(uint8_t slot)
+{
+    uint16_t addr = address(slot);
+    uint16_t crc = 0;
+
+    if (EEPROM.read(addr) != version) return false;
+    for (uint8_t i = 0; i < size + 2; i++)
+        crc = _crc_xmodem_update(crc, EEPROM.read(addr + i));
+    return crc == (EEPROM.read(addr + size + 2) | EEPROM.read(addr + size + 3) << 8);
+}
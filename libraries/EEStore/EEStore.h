@@ -0,0 +1,66 @@
+/*
+  EEStore - cached settings record in the EEPROM
+
+  The settings live in a RAM structure of the sketch. EEStore keeps a copy
+  of what is saved in the EEPROM, so changed() and dirty() compare in RAM
+  and never read the EEPROM again after begin().
+
+  The EEPROM area is split into slots of size + 4 bytes:
+
+          uint8_t  version   of the settings structure, 0xFF is never used
+          uint8_t  seq       incremented with every save
+          uint8_t  data[size]
+          uint16_t crc       CRC-16/XMODEM over version, seq and data
+
+  save() writes the next slot round-robin, so the cells wear slots times
+  slower than with a fixed address. begin() takes the valid record with the
+  highest seq. A record with a bad CRC (torn write) or another version is
+  ignored, without any valid record the PROGMEM defaults are used.
+*/
+
+#ifndef EEStore_h
+#define EEStore_h
+
+#include <inttypes.h>
+
+#define EESTORE_MAX 16 // largest settings structure
+
+class EEStore
+{
+ public:
+    // Use slots records from EEPROM address base on, slots has to be below 128
+    EEStore(uint16_t base, uint8_t slots);
+
+    // Loads the newest valid record into data (size bytes)
+    // Returns 1 if a record was found
+    // Returns 0 if data was set to defaults (in PROGMEM)
+    bool begin(void *data, uint8_t size, const void *defaults, uint8_t version);
+
+    // Returns 1 if the len bytes at offset differ from the saved record
+    bool changed(uint8_t offset, uint8_t len = 1);
+
+    // Returns 1 if anything differs from the saved record
+    bool dirty();
+
+    // Writes data into the next slot, only if it is dirty
+    // Returns 1 if a record was written
+    bool save();
+
+    // Sets data back to the saved record
+    void revert();
+
+ protected:
+    uint16_t address(uint8_t slot);
+    bool valid(uint8_t slot);
+
+    uint16_t base;
+    uint8_t slots;
+    uint8_t slot;     // slot of the saved record
+    uint8_t seq;      // seq of the saved record
+    uint8_t size;
+    uint8_t version;
+    uint8_t *data;
+    uint8_t saved[EESTORE_MAX];
+};
+
+#endif
@@ -0,0 +1,121 @@
+// Please read EnergyMeter.h for information about the estimates and their units
+
+#include "EnergyMeter.h"
+
+EnergyMeter::EnergyMeter()
+    : empty(0)
+    , full(1)
+    , capacity(0)
+    , seg_pulses(0)
+    , started(false)
+    , energy(0)
+    , res16(0)
+    , ocv8(0)
+    , start_wh_km(0)
+    , window(0)
+    , open_energy(0)
+    , open_pulses(0)
+    , seg_idx(0)
+    , seg_count(0)
+{
+    for (uint8_t i = 0; i < ENERGYMETER_SEGMENTS; i++)
+        seg_energy[i] = 0;
+}
+
+void EnergyMeter::battery(int16_t empty, int16_t full, uint16_t capacity)
+{
+    this->empty = empty;
+    this->full = full > empty ? full : empty + 1;
+    this->capacity = capacity;
+}
+
+void EnergyMeter::distance(uint32_t pulses_km)
+{
+    seg_pulses = pulses_km / ENERGYMETER_SEGMENTS;
+}
+
+void EnergyMeter::resistance(uint16_t milliohm)
+{
+    res16 = milliohm << 4;
+}
+
+void EnergyMeter::consumption(int16_t wh_km)
+{
+    start_wh_km = wh_km;
+}
+
+void EnergyMeter::update(int16_t v_in, int32_t current_in, int32_t amp_hours, int32_t amp_hours_charged, int32_t tacho)
+{
+    int32_t ocv;
+
+    if (!started) {
+        started = true;
+        ocv8 = (v_in + current_in * (res16 >> 4) / 10000) * 8;
+    } else {
+        // Energy, 0.1mAh * 0.1V = 1e-5 Wh
+        if (amp_hours >= last_ah && amp_hours_charged >= last_ahc) {
+            int32_t e = ((amp_hours - last_ah) - (amp_hours_charged - last_ahc)) * ((v_in + last_volt) / 2);
+            energy += e;
+            open_energy += e;
+        }
+
+        // Resistance, 0.1V / 0.01A = 10 Ohm = 10000 mOhm
+        int32_t di = current_in - last_current;
+        if (di >= ENERGYMETER_STEP || di <= -ENERGYMETER_STEP) {
+            int32_t r = (int32_t)(last_volt - v_in) * 10000 / di;
+            if (r < 0) r = 0;
+            if (r > 1000) r = 1000;
+            res16 += r - (res16 >> 4);
+        }
+
+        // Distance, at most one segment closes per frame, a jump after a long gap is dropped
+        if (tacho > last_tacho)
+            open_pulses += tacho - last_tacho;
+        if (seg_pulses && open_pulses >= seg_pulses) {
+            window += open_energy - seg_energy[seg_idx];
+            seg_energy[seg_idx] = open_energy;
+            if (++seg_idx == ENERGYMETER_SEGMENTS)
+                seg_idx = 0;
+            if (seg_count < ENERGYMETER_SEGMENTS)
+                seg_count++;
+            open_energy = 0;
+            open_pulses -= seg_pulses;
+            if (open_pulses >= seg_pulses)
+                open_pulses = 0;
+        }
+    }
+
+    // Open circuit voltage, 0.01A * mOhm = 1e-5 V
+    ocv = v_in + current_in * (res16 >> 4) / 10000;
+    ocv8 += ocv - (ocv8 >> 3);
+
+    last_volt = v_in;
+    last_current = current_in;
+    last_ah = amp_hours;
+    last_ahc = amp_hours_charged;
+    last_tacho = tacho;
+}
+
+int16_t EnergyMeter::whKm()
+{
+    if (!seg_count) return start_wh_km;
+    // Energy per segment * segments per km, 1e-5 Wh -> 0.1 Wh
+    return window / seg_count * ENERGYMETER_SEGMENTS / 10000;
+}
+
+uint8_t EnergyMeter::soc()
+{
+    int32_t v = ocv8 >> 3;
+    if (v <= empty) return 0;
+    if (v >= full) return 255;
+    return (v - empty) * 255 / (full - empty);
+}
+
+uint16_t EnergyMeter::range()
+{
+    int16_t wh_km = whKm();
+    if (wh_km <= 0) return 0xFFFF;
+    // 0.1Wh * 10 / 0.1Wh/km = 0.1km
+    uint32_t km = (uint32_t)soc() * capacity * 100 / 255 / wh_km;
+    return km < 0xFFFF ? km : 0xFFFE;
+}
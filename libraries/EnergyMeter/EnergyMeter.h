@@ -0,0 +1,96 @@
+/*
+  EnergyMeter - energy, consumption, state of charge and range from the VESC values
+
+  update() takes one telemetry frame in the fixed point steps of VescUart and
+  does a constant amount of integer work, no floats and no loops over a
+  history, so it can run for every frame the remote receives.
+
+          energy      the change of amp_hours - amp_hours_charged times the
+                      mean v_in of the two frames, in 1e-5 Wh. The VESC counts
+                      the amp hours itself, so frames lost on the radio lose
+                      no energy. A counter that goes back (VESC restart) is
+                      skipped.
+          Wh/km       ENERGYMETER_SEGMENTS distance segments of 1/SEGMENTS km
+                      each keep their energy in a ring, the window sum is
+                      updated when a segment closes. Until the ring is full
+                      the value is the mean over the closed segments.
+          resistance  a current step of at least ENERGYMETER_STEP between two
+                      frames gives R = -dV / dI, filtered with 1/16 per step.
+                      v_in has 0.1V steps, the large current step keeps the
+                      error of a single estimate small.
+          SoC         the open circuit voltage v_in + current_in * R, filtered
+                      with 1/8 per frame, between the empty and the full
+                      voltage. 0..255, no drop of the bar under load.
+          range       SoC * capacity / Wh/km
+
+  RAM is fixed, 4 bytes per segment and about 40 bytes of state.
+*/
+
+#ifndef EnergyMeter_h
+#define EnergyMeter_h
+
+#include <inttypes.h>
+
+#define ENERGYMETER_SEGMENTS 10 // rolling window of 1 km
+#define ENERGYMETER_STEP 1000   // [0.01A] current step for a resistance estimate
+
+class EnergyMeter
+{
+ public:
+    // Create an instance of the meter
+    EnergyMeter();
+
+    // Sets the battery voltages [0.1V] and the usable capacity [Wh]
+    void battery(int16_t empty, int16_t full, uint16_t capacity);
+
+    // Sets the tachometer pulses per km
+    void distance(uint32_t pulses_km);
+
+    // Sets the starting internal resistance [mOhm], used until the first current step
+    void resistance(uint16_t milliohm);
+
+    // Sets the consumption [0.1Wh/km] used before the first segment closes
+    void consumption(int16_t wh_km);
+
+    // Takes one telemetry frame, v_in [0.1V], current_in [0.01A], amp hours [0.1mAh], tachometer pulses
+    void update(int16_t v_in, int32_t current_in, int32_t amp_hours, int32_t amp_hours_charged, int32_t tacho);
+
+    // Returns the energy since the first frame [0.1Wh], regenerated energy counts negative
+    int32_t used() { return energy / 10000; }
+
+    // Returns the consumption over the rolling window [0.1Wh/km], the start value before the first segment
+    int16_t whKm();
+
+    // Returns the internal resistance estimate [mOhm]
+    uint16_t resistance() { return res16 >> 4; }
+
+    // Returns the sag compensated state of charge, 0 = empty, 255 = full
+    uint8_t soc();
+
+    // Returns the remaining range [0.1km], 0xFFFF without consumption (downhill)
+    uint16_t range();
+
+ protected:
+    int16_t empty;
+    int16_t full;
+    uint16_t capacity;    // [Wh]
+    uint32_t seg_pulses;  // tachometer pulses per segment
+    bool started;
+    int16_t last_volt;    // [0.1V]
+    int32_t last_current; // [0.01A]
+    int32_t last_ah;      // [0.1mAh]
+    int32_t last_ahc;     // [0.1mAh]
+    int32_t last_tacho;
+    int32_t energy;       // [1e-5 Wh] since the first frame
+    uint16_t res16;       // [mOhm / 16]
+    int32_t ocv8;         // [0.1V / 8] open circuit voltage
+    int16_t start_wh_km;  // [0.1Wh/km]
+    int32_t seg_energy[ENERGYMETER_SEGMENTS];
+    int32_t window;       // sum of seg_energy
+    int32_t open_energy;  // of the open segment
+    uint32_t open_pulses;
+    uint8_t seg_idx;      // next segment to overwrite
+    uint8_t seg_count;    // closed segments in the ring
+};
+
+#endif
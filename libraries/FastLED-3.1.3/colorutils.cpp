@@ -2,8 +2,10 @@
 #define __PROG_TYPES_COMPAT__
 
 #include <stdint.h>
+#include <string.h>
 
 #include "FastLED.h"
+#include "colorutils_simd.h"
 
 FASTLED_NAMESPACE_BEGIN
 
@@ -97,6 +99,14 @@ void fill_gradient_RGB( CRGB* leds,
     accum88 r88 = startcolor.r << 8;
     accum88 g88 = startcolor.g << 8;
     accum88 b88 = startcolor.b << 8;
+#if COLORUTILS_SIMD
+    if( simd_level()) {
+        const uint16_t acc88[3] = { r88, g88, b88 };
+        const int16_t delta87[3] = { rdelta87, gdelta87, bdelta87 };
+        simd_gradient( (uint8_t*)(leds + startpos), (uint32_t)endpos - startpos + 1, acc88, delta87);
+        return;
+    }
+#endif
     for( uint16_t i = startpos; i <= endpos; i++) {
         leds[i] = CRGB( r88 >> 8, g88 >> 8, b88 >> 8);
         r88 += rdelta87;
@@ -203,9 +213,25 @@ void nscale8_raw( CRGB* leds, uint16_t num_leds, uint8_t scale)
 
 void nscale8( CRGB* leds, uint16_t num_leds, uint8_t scale)
 {
+#if COLORUTILS_SIMD
+    if( simd_level()) {
+        simd_scale8( (uint8_t*)leds, (uint32_t)num_leds * sizeof(CRGB), scale);
+        return;
+    }
+#endif
+#if SCALE8_C == 1
+    // Without the asm scale8 the array is handled as one run of bytes,
+    // which the compiler can vectorize. Same results as CRGB::nscale8.
+    uint8_t* p = (uint8_t*)leds;
+    uint32_t n = (uint32_t)num_leds * sizeof(CRGB);
+    for( uint32_t i = 0; i < n; i++) {
+        p[i] = scale8( p[i], scale);
+    }
+#else
     for( uint16_t i = 0; i < num_leds; i++) {
         leds[i].nscale8( scale);
     }
+#endif
 }
 
 void fadeUsingColor( CRGB* leds, uint16_t numLeds, const CRGB& colormask)
@@ -252,11 +278,35 @@ CRGB& nblend( CRGB& existing, const CRGB& overlay, fract8 amountOfOverlay )
 
 void nblend( CRGB* existing, CRGB* overlay, uint16_t count, fract8 amountOfOverlay)
 {
+#if SCALE8_C == 1
+    // Byte run version, see nscale8. Same results as the per pixel nblend.
+    if( amountOfOverlay == 0) {
+        return;
+    }
+    if( amountOfOverlay == 255) {
+        memmove( (void*)existing, overlay, count * sizeof(CRGB));
+        return;
+    }
+#if COLORUTILS_SIMD
+    if( simd_level()) {
+        simd_blend( (uint8_t*)existing, (uint8_t*)overlay, (uint8_t*)existing, (uint32_t)count * sizeof(CRGB), amountOfOverlay);
+        return;
+    }
+#endif
+    fract8 amountOfKeep = 255 - amountOfOverlay;
+    uint8_t* e = (uint8_t*)existing;
+    const uint8_t* o = (const uint8_t*)overlay;
+    uint32_t n = (uint32_t)count * sizeof(CRGB);
+    for( uint32_t i = 0; i < n; i++) {
+        e[i] = scale8( e[i], amountOfKeep) + scale8( o[i], amountOfOverlay);
+    }
+#else
     for( uint16_t i = count; i; i--) {
         nblend( *existing, *overlay, amountOfOverlay);
         existing++;
         overlay++;
     }
+#endif
 }
 
 CRGB blend( const CRGB& p1, const CRGB& p2, fract8 amountOfP2 )
@@ -268,6 +318,12 @@ CRGB blend( const CRGB& p1, const CRGB& p2, fract8 amountOfP2 )
 
 CRGB* blend( const CRGB* src1, const CRGB* src2, CRGB* dest, uint16_t count, fract8 amountOfsrc2 )
 {
+#if COLORUTILS_SIMD
+    if( simd_level()) {
+        simd_blend( (const uint8_t*)src1, (const uint8_t*)src2, (uint8_t*)dest, (uint32_t)count * sizeof(CRGB), amountOfsrc2);
+        return dest;
+    }
+#endif
     for( uint16_t i = 0; i < count; i++) {
         dest[i] = blend(src1[i], src2[i], amountOfsrc2);
     }
@@ -375,6 +431,12 @@ void blur1d( CRGB* leds, uint16_t numLeds, fract8 blur_amount)
 {
     uint8_t keep = 255 - blur_amount;
     uint8_t seep = blur_amount >> 1;
+#if COLORUTILS_SIMD
+    if( simd_level()) {
+        simd_blur1d( (uint8_t*)leds, (uint32_t)numLeds * sizeof(CRGB), keep, seep);
+        return;
+    }
+#endif
     CRGB carryover = CRGB::Black;
     for( uint16_t i = 0; i < numLeds; i++) {
         CRGB cur = leds[i];
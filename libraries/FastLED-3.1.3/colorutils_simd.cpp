@@ -0,0 +1,279 @@
+#define FASTLED_INTERNAL
+#include <stdint.h>
+
+#include "FastLED.h"
+#include "colorutils_simd.h"
+
+#if COLORUTILS_SIMD
+
+#include <immintrin.h>
+
+FASTLED_NAMESPACE_BEGIN
+
+// The multiplier of scale8 in 16 bit lanes, (x * factor) >> 8 is scale8( x, scale)
+static inline uint16_t scale8_factor( uint8_t scale)
+{
+#if FASTLED_SCALE8_FIXED == 1
+    return (uint16_t)scale + 1;
+#else
+    return scale;
+#endif
+}
+
+static uint8_t simd_active = 0xFF; // not probed yet
+
+uint8_t simd_supported()
+{
+    __builtin_cpu_init();
+    if( __builtin_cpu_supports( "avx2")) {
+        return SIMD_AVX2;
+    }
+    return SIMD_SSE2; // part of every x86-64 and required by this build
+}
+
+uint8_t simd_level()
+{
+    if( simd_active == 0xFF) {
+        simd_active = simd_supported();
+    }
+    return simd_active;
+}
+
+void set_simd_level( uint8_t level)
+{
+    uint8_t supported = simd_supported();
+    simd_active = level < supported ? level : supported;
+}
+
+
+// SSE2, 16 bytes at a time
+
+static inline __m128i scale8_sse2( __m128i x, __m128i factor)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i lo = _mm_srli_epi16( _mm_mullo_epi16( _mm_unpacklo_epi8( x, zero), factor), 8);
+    __m128i hi = _mm_srli_epi16( _mm_mullo_epi16( _mm_unpackhi_epi8( x, zero), factor), 8);
+    return _mm_packus_epi16( lo, hi);
+}
+
+static uint32_t scale8_run_sse2( uint8_t* p, uint32_t n, uint8_t scale)
+{
+    const __m128i factor = _mm_set1_epi16( scale8_factor( scale));
+    uint32_t i = 0;
+    for( ; i + 16 <= n; i += 16) {
+        __m128i x = _mm_loadu_si128( (const __m128i*)(p + i));
+        _mm_storeu_si128( (__m128i*)(p + i), scale8_sse2( x, factor));
+    }
+    return i;
+}
+
+static uint32_t blend_run_sse2( const uint8_t* a, const uint8_t* b, uint8_t* dest, uint32_t n, uint8_t amountOfB)
+{
+    const __m128i keep = _mm_set1_epi16( scale8_factor( 255 - amountOfB));
+    const __m128i take = _mm_set1_epi16( scale8_factor( amountOfB));
+    uint32_t i = 0;
+    for( ; i + 16 <= n; i += 16) {
+        __m128i x = _mm_loadu_si128( (const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128( (const __m128i*)(b + i));
+        // Two 8 bit results added with wrap around, like the scalar uint8_t sum
+        _mm_storeu_si128( (__m128i*)(dest + i), _mm_add_epi8( scale8_sse2( x, keep), scale8_sse2( y, take)));
+    }
+    return i;
+}
+
+// In place: the left neighbours of a block come from the block before, which
+// is already written, so it is kept in a register. Leaves the original last
+// 3 bytes in before[] for the scalar tail.
+static uint32_t blur_run_sse2( uint8_t* p, uint32_t n, uint8_t keep, uint8_t seep, uint8_t before[16])
+{
+    const __m128i k = _mm_set1_epi16( scale8_factor( keep));
+    const __m128i s = _mm_set1_epi16( scale8_factor( seep));
+    __m128i prev = _mm_setzero_si128();
+    uint32_t i = 0;
+    for( ; i + 16 + 3 <= n; i += 16) {
+        __m128i cur = _mm_loadu_si128( (const __m128i*)(p + i));
+        __m128i right = _mm_loadu_si128( (const __m128i*)(p + i + 3));
+        __m128i left = _mm_or_si128( _mm_srli_si128( prev, 13), _mm_slli_si128( cur, 3));
+        __m128i v = _mm_adds_epu8( scale8_sse2( cur, k), scale8_sse2( left, s));
+        _mm_storeu_si128( (__m128i*)(p + i), _mm_adds_epu8( v, scale8_sse2( right, s)));
+        prev = cur;
+    }
+    _mm_storeu_si128( (__m128i*)before, prev);
+    return i;
+}
+
+// Lane l of the vectors is byte l of 8 pixels, channel l % 3 of pixel l / 3
+static uint32_t gradient_run_sse2( uint8_t* p, uint32_t count, const uint16_t acc88[3], const int16_t delta87[3])
+{
+    uint16_t acc[24], step[24];
+    for( uint8_t b = 0; b < 24; b++) {
+        acc[b] = acc88[b % 3] + (b / 3) * delta87[b % 3];
+        step[b] = 8 * delta87[b % 3];
+    }
+    __m128i a0 = _mm_loadu_si128( (const __m128i*)acc);
+    __m128i a1 = _mm_loadu_si128( (const __m128i*)(acc + 8));
+    __m128i a2 = _mm_loadu_si128( (const __m128i*)(acc + 16));
+    const __m128i s0 = _mm_loadu_si128( (const __m128i*)step);
+    const __m128i s1 = _mm_loadu_si128( (const __m128i*)(step + 8));
+    const __m128i s2 = _mm_loadu_si128( (const __m128i*)(step + 16));
+    const __m128i zero = _mm_setzero_si128();
+    uint32_t k = 0;
+    for( ; k + 8 <= count; k += 8, p += 24) {
+        __m128i lo = _mm_packus_epi16( _mm_srli_epi16( a0, 8), _mm_srli_epi16( a1, 8));
+        __m128i hi = _mm_packus_epi16( _mm_srli_epi16( a2, 8), zero);
+        _mm_storeu_si128( (__m128i*)p, lo);
+        _mm_storel_epi64( (__m128i*)(p + 16), hi);
+        a0 = _mm_add_epi16( a0, s0);
+        a1 = _mm_add_epi16( a1, s1);
+        a2 = _mm_add_epi16( a2, s2);
+    }
+    return k;
+}
+
+
+// AVX2, 32 bytes at a time. unpack and pack work within the 128 bit lanes,
+// as inverse pairs they keep the byte order.
+
+__attribute__((target("avx2")))
+static inline __m256i scale8_avx2( __m256i x, __m256i factor)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i lo = _mm256_srli_epi16( _mm256_mullo_epi16( _mm256_unpacklo_epi8( x, zero), factor), 8);
+    __m256i hi = _mm256_srli_epi16( _mm256_mullo_epi16( _mm256_unpackhi_epi8( x, zero), factor), 8);
+    return _mm256_packus_epi16( lo, hi);
+}
+
+__attribute__((target("avx2")))
+static uint32_t scale8_run_avx2( uint8_t* p, uint32_t n, uint8_t scale)
+{
+    const __m256i factor = _mm256_set1_epi16( scale8_factor( scale));
+    uint32_t i = 0;
+    for( ; i + 32 <= n; i += 32) {
+        __m256i x = _mm256_loadu_si256( (const __m256i*)(p + i));
+        _mm256_storeu_si256( (__m256i*)(p + i), scale8_avx2( x, factor));
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+static uint32_t blend_run_avx2( const uint8_t* a, const uint8_t* b, uint8_t* dest, uint32_t n, uint8_t amountOfB)
+{
+    const __m256i keep = _mm256_set1_epi16( scale8_factor( 255 - amountOfB));
+    const __m256i take = _mm256_set1_epi16( scale8_factor( amountOfB));
+    uint32_t i = 0;
+    for( ; i + 32 <= n; i += 32) {
+        __m256i x = _mm256_loadu_si256( (const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256( (const __m256i*)(b + i));
+        _mm256_storeu_si256( (__m256i*)(dest + i), _mm256_add_epi8( scale8_avx2( x, keep), scale8_avx2( y, take)));
+    }
+    return i;
+}
+
+// The left neighbours cross the 128 bit lanes: permute2x128 puts the high
+// lane of the block before next to the low lane of this one, alignr shifts
+// each lane pair by the 3 bytes of a pixel.
+__attribute__((target("avx2")))
+static uint32_t blur_run_avx2( uint8_t* p, uint32_t n, uint8_t keep, uint8_t seep, uint8_t before[16])
+{
+    const __m256i k = _mm256_set1_epi16( scale8_factor( keep));
+    const __m256i s = _mm256_set1_epi16( scale8_factor( seep));
+    __m256i prev = _mm256_setzero_si256();
+    uint32_t i = 0;
+    for( ; i + 32 + 3 <= n; i += 32) {
+        __m256i cur = _mm256_loadu_si256( (const __m256i*)(p + i));
+        __m256i right = _mm256_loadu_si256( (const __m256i*)(p + i + 3));
+        __m256i left = _mm256_alignr_epi8( cur, _mm256_permute2x128_si256( prev, cur, 0x21), 13);
+        __m256i v = _mm256_adds_epu8( scale8_avx2( cur, k), scale8_avx2( left, s));
+        _mm256_storeu_si256( (__m256i*)(p + i), _mm256_adds_epu8( v, scale8_avx2( right, s)));
+        prev = cur;
+    }
+    _mm_storeu_si128( (__m128i*)before, _mm256_extracti128_si256( prev, 1));
+    return i;
+}
+
+// 16 pixels in 3 vectors of 16 lanes, pack and permute4x64 put the lane halves back in order
+__attribute__((target("avx2")))
+static uint32_t gradient_run_avx2( uint8_t* p, uint32_t count, const uint16_t acc88[3], const int16_t delta87[3])
+{
+    uint16_t acc[48], step[48];
+    for( uint8_t b = 0; b < 48; b++) {
+        acc[b] = acc88[b % 3] + (b / 3) * delta87[b % 3];
+        step[b] = 16 * delta87[b % 3];
+    }
+    __m256i a0 = _mm256_loadu_si256( (const __m256i*)acc);
+    __m256i a1 = _mm256_loadu_si256( (const __m256i*)(acc + 16));
+    __m256i a2 = _mm256_loadu_si256( (const __m256i*)(acc + 32));
+    const __m256i s0 = _mm256_loadu_si256( (const __m256i*)step);
+    const __m256i s1 = _mm256_loadu_si256( (const __m256i*)(step + 16));
+    const __m256i s2 = _mm256_loadu_si256( (const __m256i*)(step + 32));
+    uint32_t k = 0;
+    for( ; k + 16 <= count; k += 16, p += 48) {
+        __m256i h2 = _mm256_srli_epi16( a2, 8);
+        __m256i lo = _mm256_packus_epi16( _mm256_srli_epi16( a0, 8), _mm256_srli_epi16( a1, 8));
+        __m256i hi = _mm256_packus_epi16( h2, h2);
+        _mm256_storeu_si256( (__m256i*)p, _mm256_permute4x64_epi64( lo, 0xD8));
+        _mm_storeu_si128( (__m128i*)(p + 32), _mm256_castsi256_si128( _mm256_permute4x64_epi64( hi, 0xD8)));
+        a0 = _mm256_add_epi16( a0, s0);
+        a1 = _mm256_add_epi16( a1, s1);
+        a2 = _mm256_add_epi16( a2, s2);
+    }
+    return k;
+}
+
+
+// Dispatch, the scalar loops finish what the vectors leave
+
+void simd_scale8( uint8_t* p, uint32_t n, fract8 scale)
+{
+    uint32_t i = simd_level() >= SIMD_AVX2 ? scale8_run_avx2( p, n, scale) : scale8_run_sse2( p, n, scale);
+    for( ; i < n; i++) {
+        p[i] = scale8( p[i], scale);
+    }
+}
+
+void simd_blend( const uint8_t* a, const uint8_t* b, uint8_t* dest, uint32_t n, fract8 amountOfB)
+{
+    uint32_t i = simd_level() >= SIMD_AVX2 ? blend_run_avx2( a, b, dest, n, amountOfB)
+                                            : blend_run_sse2( a, b, dest, n, amountOfB);
+    fract8 amountOfKeep = 255 - amountOfB;
+    for( ; i < n; i++) {
+        dest[i] = scale8( a[i], amountOfKeep) + scale8( b[i], amountOfB);
+    }
+}
+
+void simd_blur1d( uint8_t* p, uint32_t n, uint8_t keep, uint8_t seep)
+{
+    uint8_t before[16];
+    uint8_t left[3] = { 0, 0, 0 }; // original byte i - 3 at left[i % 3], black before the first pixel
+    uint32_t i = simd_level() >= SIMD_AVX2 ? blur_run_avx2( p, n, keep, seep, before)
+                                            : blur_run_sse2( p, n, keep, seep, before);
+    if( i) {
+        for( uint8_t j = 1; j <= 3; j++) {
+            left[(i - j) % 3] = before[16 - j];
+        }
+    }
+    for( ; i < n; i++) {
+        uint8_t cur = p[i];
+        uint8_t v = qadd8( scale8( cur, keep), scale8( left[i % 3], seep));
+        if( i + 3 < n) {
+            v = qadd8( v, scale8( p[i + 3], seep));
+        }
+        left[i % 3] = cur;
+        p[i] = v;
+    }
+}
+
+void simd_gradient( uint8_t* p, uint32_t count, const uint16_t acc88[3], const int16_t delta87[3])
+{
+    uint32_t k = simd_level() >= SIMD_AVX2 ? gradient_run_avx2( p, count, acc88, delta87)
+                                            : gradient_run_sse2( p, count, acc88, delta87);
+    for( p += k * 3; k < count; k++) {
+        for( uint8_t c = 0; c < 3; c++) {
+            *p++ = (uint16_t)(acc88[c] + k * delta87[c]) >> 8;
+        }
+    }
+}
+
+FASTLED_NAMESPACE_END
+
+#endif
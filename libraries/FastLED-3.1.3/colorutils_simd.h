@@ -0,0 +1,60 @@
+#ifndef __INC_COLORUTILS_SIMD_H
+#define __INC_COLORUTILS_SIMD_H
+
+///@file colorutils_simd.h
+/// SSE2 and AVX2 kernels behind the CRGB array functions of colorutils, for
+/// x86 hosts that render many frames (previews, simulations). They treat an
+/// array as one run of bytes and give the same bytes as the scalar lib8tion
+/// code. The AVX2 kernels are picked at run time when the CPU has them.
+/// Not built for AVR and ARM, there COLORUTILS_SIMD is 0 and colorutils
+/// keeps its scalar loops.
+
+#if defined(__SSE2__) && (defined(__x86_64__) || defined(__i386__)) && !defined(__AVR__)
+#define COLORUTILS_SIMD 1
+#else
+#define COLORUTILS_SIMD 0
+#endif
+
+#if COLORUTILS_SIMD
+
+#include <stdint.h>
+
+FASTLED_NAMESPACE_BEGIN
+
+///@ingroup Colorutils
+///@{
+
+/// Kernel sets, SIMD_SCALAR runs the plain loops of colorutils
+enum { SIMD_SCALAR = 0, SIMD_SSE2 = 1, SIMD_AVX2 = 2 };
+
+/// Best kernel set of this CPU
+uint8_t simd_supported();
+
+/// Kernel set the array functions use, simd_supported() unless lowered
+uint8_t simd_level();
+
+/// Lowers the kernel set, e.g. to compare them; capped at simd_supported()
+void set_simd_level( uint8_t level);
+
+/// p[i] = scale8( p[i], scale) for n bytes
+void simd_scale8( uint8_t* p, uint32_t n, fract8 scale);
+
+/// dest[i] = scale8( a[i], 255 - amountOfB) + scale8( b[i], amountOfB) for n bytes,
+/// dest may be a or b
+void simd_blend( const uint8_t* a, const uint8_t* b, uint8_t* dest, uint32_t n, fract8 amountOfB);
+
+/// blur1d over n bytes of RGB pixels: every byte keeps scale8( keep) of itself
+/// and gets scale8( seep) of the same channel of both neighbours, saturating
+void simd_blur1d( uint8_t* p, uint32_t n, uint8_t keep, uint8_t seep);
+
+/// fill_gradient_RGB from its 8.8 start values and 8.7 deltas per pixel:
+/// pixel k gets the high bytes of acc88 + k * delta87, wrapping like accum88
+void simd_gradient( uint8_t* p, uint32_t count, const uint16_t acc88[3], const int16_t delta87[3]);
+
+///@}
+
+FASTLED_NAMESPACE_END
+
+#endif
+
+#endif
@@ -47,15 +47,16 @@ LIB8STATIC_ALWAYS_INLINE uint8_t qadd8( uint8_t i, uint8_t j)
 #endif
 }
 
-/// Add one byte to another, saturating at 0x7F
+/// Add one byte to another, saturating at 0x7F and -0x80
 /// @param i - first byte to add
 /// @param j - second byte to add
-/// @returns the sum of i & j, capped at 0xFF
+/// @returns the sum of i & j, capped at 0x7F and -0x80
 LIB8STATIC_ALWAYS_INLINE int8_t qadd7( int8_t i, int8_t j)
 {
 #if QADD7_C == 1
     int16_t t = i + j;
     if( t > 127) t = 127;
+    if( t < -128) t = -128;
     return t;
 #elif QADD7_AVRASM == 1
     asm volatile(
@@ -64,10 +65,13 @@ LIB8STATIC_ALWAYS_INLINE int8_t qadd7( int8_t i, int8_t j)
 
          /* Now test the V flag.
           If V is clear, we branch around a load of 0x7F into i.
-          If V is set, we go ahead and load 0x7F into i.
+          If V is set, we go ahead and load 0x7F into i,
+          or 0x80 if j (and so i) was negative.
           */
          "brvc L_%=     \n\t"
          "ldi %0, 0x7F  \n\t"
+         "sbrc %1, 7    \n\t"
+         "ldi %0, 0x80  \n\t"
          "L_%=: "
          : "+a" (i)
          : "a"  (j) );
@@ -196,7 +200,7 @@ LIB8STATIC_ALWAYS_INLINE uint16_t avg16( uint16_t i, uint16_t j)
 LIB8STATIC_ALWAYS_INLINE int8_t avg7( int8_t i, int8_t j)
 {
 #if AVG7_C == 1
-    return ((i + j) >> 1) + (i & 0x1);
+    return (i >> 1) + (j >> 1) + (i & 0x1);
 #elif AVG7_AVRASM == 1
     asm volatile(
                  "asr %1        \n\t"
@@ -217,7 +221,7 @@ LIB8STATIC_ALWAYS_INLINE int8_t avg7( int8_t i, int8_t j)
 LIB8STATIC_ALWAYS_INLINE int16_t avg15( int16_t i, int16_t j)
 {
 #if AVG15_C == 1
-    return ((int32_t)((int32_t)(i) + (int32_t)(j)) >> 1) + (i & 0x1);
+    return (i >> 1) + (j >> 1) + (i & 0x1);
 #elif AVG15_AVRASM == 1
     asm volatile(
                  /* first divide j by 2, throwing away lowest bit */
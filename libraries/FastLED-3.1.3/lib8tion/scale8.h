@@ -418,13 +418,37 @@ LIB8STATIC_ALWAYS_INLINE uint16_t scale16by8( uint16_t i, fract8 scale )
 #if SCALE16BY8_C == 1
     uint16_t result;
 #if FASTLED_SCALE8_FIXED == 1
-    result = (i * (1+((uint16_t)scale))) >> 8;
+    result = ((uint32_t)i * (1+((uint16_t)scale))) >> 8;
 #else
-    result = (i * scale) / 256;
+    result = ((uint32_t)i * scale) / 256;
 #endif
     return result;
 #elif SCALE16BY8_AVRASM == 1
     uint16_t result = 0;
+#if FASTLED_SCALE8_FIXED == 1
+    asm volatile(
+         // result.A = HighByte( (i.A x scale) + i.A )
+         "  mul %A[i], %[scale]                 \n\t"
+         "  add r0, %A[i]                       \n\t"
+         "  adc %A[result], r1                  \n\t"
+
+         // result.A-B += i.B x scale
+         "  mul %B[i], %[scale]                 \n\t"
+         "  add %A[result], r0                  \n\t"
+         "  adc %B[result], r1                  \n\t"
+
+         // cleanup r1
+         "  clr __zero_reg__                    \n\t"
+
+         // result.A-B += i.B
+         "  add %A[result], %B[i]               \n\t"
+         "  adc %B[result], __zero_reg__        \n\t"
+
+         : [result] "+r" (result)
+         : [i] "r" (i), [scale] "r" (scale)
+         : "r0", "r1"
+         );
+#else
     asm volatile(
          // result.A = HighByte(i.A x j )
          "  mul %A[i], %[scale]                 \n\t"
@@ -443,6 +467,7 @@ LIB8STATIC_ALWAYS_INLINE uint16_t scale16by8( uint16_t i, fract8 scale )
          : [i] "r" (i), [scale] "r" (scale)
          : "r0", "r1"
          );
+#endif
     return result;
 #else
     #error "No implementation for scale16by8 available."
@@ -515,6 +540,14 @@ LIB8STATIC uint16_t scale16( uint16_t i, fract16 scale )
                  "  adc %C[result], r1                   \n\t"
                  "  adc %D[result], %[zero]              \n\t"
 
+#if FASTLED_SCALE8_FIXED == 1
+                 // result.A-D += i.A-B
+                 "  add %A[result], %A[i]                \n\t"
+                 "  adc %B[result], %B[i]                \n\t"
+                 "  adc %C[result], %[zero]              \n\t"
+                 "  adc %D[result], %[zero]              \n\t"
+#endif
+
                  // cleanup r1
                  "  clr r1                               \n\t"
 
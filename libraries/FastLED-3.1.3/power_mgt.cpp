@@ -63,6 +63,11 @@ uint32_t calculate_unscaled_power_mW( const CRGB* ledbuffer, uint16_t numLeds )
         count--;
     }
 
+    return calculate_unscaled_power_mW( red32, green32, blue32, numLeds);
+}
+
+uint32_t calculate_unscaled_power_mW( uint32_t red32, uint32_t green32, uint32_t blue32, uint16_t numLeds )
+{
     red32   *= gRed_mW;
     green32 *= gGreen_mW;
     blue32  *= gBlue_mW;
@@ -82,8 +87,10 @@ uint8_t calculate_max_brightness_for_power_vmA(const CRGB* ledbuffer, uint16_t n
 }
 
 uint8_t calculate_max_brightness_for_power_mW(const CRGB* ledbuffer, uint16_t numLeds, uint8_t target_brightness, uint32_t max_power_mW) {
- 	uint32_t total_mW = calculate_unscaled_power_mW( ledbuffer, numLeds);
+	return calculate_max_brightness_for_unscaled_power_mW(calculate_unscaled_power_mW( ledbuffer, numLeds), target_brightness, max_power_mW);
+}
 
+uint8_t calculate_max_brightness_for_unscaled_power_mW(uint32_t total_mW, uint8_t target_brightness, uint32_t max_power_mW) {
 	uint32_t requested_power_mW = ((uint32_t)total_mW * target_brightness) / 256;
 
 	uint8_t recommended_brightness = target_brightness;
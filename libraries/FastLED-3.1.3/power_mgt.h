@@ -58,6 +58,16 @@ void delay_at_max_brightness_for_power( uint16_t ms);
 ///
 uint32_t calculate_unscaled_power_mW( const CRGB* ledbuffer, uint16_t numLeds);
 
+/// calculate_unscaled_power_mW from the sums of the red, green and blue
+///   values of numLeds leds, for callers that keep these sums up to date
+///   while writing the leds instead of scanning the buffer.
+uint32_t calculate_unscaled_power_mW( uint32_t red, uint32_t green, uint32_t blue, uint16_t numLeds);
+
+/// calculate_max_brightness_for_unscaled_power_mW tells you the highest
+///   brightness level you can use and still stay under the specified power
+///   budget, for leds that draw unscaled_power_mW at brightness = 255.
+uint8_t calculate_max_brightness_for_unscaled_power_mW(uint32_t unscaled_power_mW, uint8_t target_brightness, uint32_t max_power_mW);
+
 /// calculate_max_brightness_for_power_mW tells you the highest brightness
 ///   level you can use and still stay under the specified power budget for 
 ///   a given set of leds.  It takes a pointer to an array of CRGB objects, a
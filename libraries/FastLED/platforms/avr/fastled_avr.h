@@ -1,14 +0,0 @@
-#ifndef __INC_FASTLED_AVR_H
-#define __INC_FASTLED_AVR_H
-
-#include "fastled_delay.h"
-#include "fastpin_avr.h"
-#include "fastspi_avr.h"
-#include "clockless_trinket.h"
-
-// Default to using PROGMEM
-#ifndef FASTLED_USE_PROGMEM
-#define FASTLED_USE_PROGMEM 1
-#endif
-
-#endif
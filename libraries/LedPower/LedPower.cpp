@@ -0,0 +1,32 @@
+// Please read LedPower.h for information about the sums
+
+#include "Arduino.h"
+#include "LedPower.h"
+
+LedPower::LedPower()
+    : channel_sum{0, 0, 0}
+{}
+
+void LedPower::set(CRGB *led, const CRGB &color)
+{
+    channel_sum[0] += color.r - led->r;
+    channel_sum[1] += color.g - led->g;
+    channel_sum[2] += color.b - led->b;
+    *led = color;
+}
+
+void LedPower::fill(CRGB *leds, uint8_t count, const CRGB &color)
+{
+    for (uint8_t i = 0; i < count; i++)
+        set(&leds[i], color);
+}
+
+uint32_t LedPower::power(uint16_t num_leds)
+{
+    return calculate_unscaled_power_mW(channel_sum[0], channel_sum[1], channel_sum[2], num_leds);
+}
+
+uint8_t LedPower::brightness(uint16_t num_leds, uint8_t target, uint32_t max_power)
+{
+    return calculate_max_brightness_for_unscaled_power_mW(power(num_leds), target, max_power);
+}
@@ -0,0 +1,44 @@
+/*
+  LedPower - running channel sums of the RX light strips
+
+  The leds are written only through set() and fill(). These keep the sums
+  of the red, green and blue values of all strips up to date, so power()
+  and brightness() need no scan of the buffers, the same numbers
+  calculate_unscaled_power_mW() and calculate_max_brightness_for_power_mW()
+  of FastLED give for the leds in one buffer.
+
+  The sums are 16 bit, enough for 257 leds.
+*/
+
+#ifndef LedPower_h
+#define LedPower_h
+
+#include <inttypes.h>
+#include <FastLED.h>
+
+class LedPower
+{
+ public:
+    // Create an instance for leds that are all black
+    LedPower();
+
+    // Writes one led
+    void set(CRGB *led, const CRGB &color);
+
+    // Writes count leds
+    void fill(CRGB *leds, uint8_t count, const CRGB &color);
+
+    // Returns the sum of a channel, 0 red, 1 green, 2 blue
+    uint16_t sum(uint8_t channel) { return channel_sum[channel]; }
+
+    // Returns the power of num_leds at brightness 255 [mW]
+    uint32_t power(uint16_t num_leds);
+
+    // Returns the highest brightness up to target that stays below max_power [mW]
+    uint8_t brightness(uint16_t num_leds, uint8_t target, uint32_t max_power);
+
+ protected:
+    uint16_t channel_sum[3]; // red, green, blue
+};
+
+#endif
@@ -0,0 +1,146 @@
+// Please read MotorControl.h for information about the ramps and the cruise
+
+#include "Arduino.h"
+#include "MotorControl.h"
+
+MotorControl::MotorControl()
+    : interval_millis(20)
+    , last_millis(0)
+    , drive_up(0)
+    , drive_down(0)
+    , brake_up(0)
+    , brake_down(0)
+    , min_rpm(0x7FFFFFFF)
+    , ramp_rpm(0)
+    , nudge_rpm(0)
+    , cancel(-128)
+    , current(0)
+    , cruise_active(false)
+    , cruise_locked(false)
+    , cruise_rpm(0)
+    , rpm(0)
+{}
+
+void MotorControl::period(uint8_t interval_millis)
+{
+    this->interval_millis = interval_millis;
+}
+
+void MotorControl::ramps(uint16_t drive_up, uint16_t drive_down, uint16_t brake_up, uint16_t brake_down)
+{
+    this->drive_up = drive_up;
+    this->drive_down = drive_down;
+    this->brake_up = brake_up;
+    this->brake_down = brake_down;
+}
+
+void MotorControl::cruise(int32_t min_rpm, uint16_t ramp_rpm, uint8_t nudge_rpm, int8_t cancel)
+{
+    this->min_rpm = min_rpm;
+    this->ramp_rpm = ramp_rpm;
+    this->nudge_rpm = nudge_rpm;
+    this->cancel = cancel;
+}
+
+bool MotorControl::update(const RemoteDataStruct &remote, const bldcMeasure &vesc)
+{
+    if (!tick())
+        return false;
+    if (engaged(remote, vesc))
+        holdRpm(remote);
+    else
+        current = ramp(target(remote));
+    return true;
+}
+
+uint8_t MotorControl::command()
+{
+    if (cruise_active)
+        return COMM_SET_RPM;
+    return current < 0 ? COMM_SET_CURRENT_BRAKE : COMM_SET_CURRENT;
+}
+
+int32_t MotorControl::value()
+{
+    if (cruise_active)
+        return rpm;
+    return current < 0 ? -current : current;
+}
+
+int32_t MotorControl::target(const RemoteDataStruct &remote)
+{
+    int8_t thr = remote.thr;
+    if (thr > (int16_t)remote._deadband)
+        return (int32_t)thr * remote._amp_fwd * 500 / 127; // LSB 0.5A
+    if (thr < -(int16_t)remote._deadband)
+        return (int32_t)thr * remote._amp_break * 100 / 127; // LSB 0.1A
+    return 0;
+}
+
+// True once per period
+bool MotorControl::tick()
+{
+    uint32_t now = millis();
+    if (now - last_millis < interval_millis)
+        return false;
+    last_millis += interval_millis;
+    if (now - last_millis >= interval_millis) // late by more than a period, don't send a burst to catch up
+        last_millis = now;
+    return true;
+}
+
+// One step from current towards target, every direction with its own rate
+int32_t MotorControl::ramp(int32_t target)
+{
+    int32_t next;
+    if (current > 0 || (current == 0 && target > 0)) {
+        if (target >= current)
+            return min(target, current + drive_up);
+        next = current - drive_down;
+        if (next >= 0 || target >= 0)
+            return max(target, next);
+        return max(target, -(int32_t)brake_up);
+    }
+    if (target <= current)
+        return max(target, current - brake_up);
+    next = current + brake_down;
+    if (next <= 0 || target <= 0)
+        return min(target, next);
+    return min(target, (int32_t)drive_up);
+}
+
+bool MotorControl::engaged(const RemoteDataStruct &remote, const bldcMeasure &vesc)
+{
+    if (!remote.cruise || remote.thr < cancel) {
+        if (cruise_active) {
+            cruise_active = false;
+            current = vesc.current_motor * 10; // 0.01A to mA
+            if (current < 0)
+                current = 0;
+        }
+        cruise_locked = remote.cruise;
+        return false;
+    }
+    if (!cruise_active) {
+        if (cruise_locked || vesc.rpm < min_rpm)
+            return false;
+        cruise_active = true;
+        cruise_rpm = rpm = vesc.rpm;
+    }
+    return true;
+}
+
+// Stick outside the deadband nudges the set speed, the command follows it with ramp_rpm
+void MotorControl::holdRpm(const RemoteDataStruct &remote)
+{
+    int8_t thr = remote.thr;
+    if (abs(thr) > remote._deadband)
+        cruise_rpm += (int32_t)thr * nudge_rpm / 127;
+    if (cruise_rpm < min_rpm)
+        cruise_rpm = min_rpm;
+
+    if (rpm < cruise_rpm)
+        rpm = min(cruise_rpm, rpm + ramp_rpm);
+    else
+        rpm = max(cruise_rpm, rpm - ramp_rpm);
+}
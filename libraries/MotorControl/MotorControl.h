@@ -0,0 +1,86 @@
+/*
+  MotorControl - the one VESC command per period of the RX
+
+  update() runs on every loop pass with the last remote data and VESC
+  values. Once per period() it returns true, then command() and value()
+  hold the command to send. A late loop does not catch up with a burst,
+  the next period starts from there.
+
+          current  the stick outside the deadband asks for thr * _amp_fwd
+                   (LSB 0.5A) or thr * _amp_break (LSB 0.1A) / 127. The
+                   command moves towards it by at most the ramp of its
+                   direction per period, a step across zero goes on with
+                   the rate of the other side, so drive turns into brake
+                   without a period at 0A. COMM_SET_CURRENT or
+                   COMM_SET_CURRENT_BRAKE in mA.
+          cruise   with the cruise button above the lowest speed the rpm of
+                   that moment is held with COMM_SET_RPM. The stick outside
+                   the deadband nudges the set speed, the command follows
+                   the set speed with its own ramp. Releasing the button or
+                   braking past the cancel level hands back to the current
+                   ramp, starting at the motor current the VESC holds. After
+                   a cancel cruise waits until the button is released.
+
+  Integer math only, about 30 bytes of state.
+*/
+
+#ifndef MotorControl_h
+#define MotorControl_h
+
+#include <inttypes.h>
+#include <datatypes.h>
+#include <local_datatypes.h>
+
+class MotorControl
+{
+ public:
+    // Create an instance, 20ms period, no ramps and no cruise until they are set
+    MotorControl();
+
+    // Sets the command period [ms]
+    void period(uint8_t interval_millis);
+
+    // Sets the current ramps [mA per period], up = away from 0A, down = towards 0A
+    void ramps(uint16_t drive_up, uint16_t drive_down, uint16_t brake_up, uint16_t brake_down);
+
+    // Sets the lowest speed to engage cruise [erpm], the ramp of the held speed [erpm per period],
+    // the set speed change with full stick [erpm per period] and the thr that cancels cruise
+    void cruise(int32_t min_rpm, uint16_t ramp_rpm, uint8_t nudge_rpm, int8_t cancel);
+
+    // Takes the remote data and the last VESC values
+    // Returns 1 once per period, command() and value() are the command to send
+    bool update(const RemoteDataStruct &remote, const bldcMeasure &vesc);
+
+    // COMM_SET_CURRENT, COMM_SET_CURRENT_BRAKE or COMM_SET_RPM
+    uint8_t command();
+
+    // Current [mA] or rpm [erpm] of the command, never negative for the currents
+    int32_t value();
+
+    // Returns the current the stick asks for [mA], >0 motor, <0 brake
+    int32_t target(const RemoteDataStruct &remote);
+
+    // Returns 1 while cruise holds the speed
+    bool cruising() { return cruise_active; }
+
+ protected:
+    bool tick();
+    int32_t ramp(int32_t target);
+    bool engaged(const RemoteDataStruct &remote, const bldcMeasure &vesc);
+    void holdRpm(const RemoteDataStruct &remote);
+
+    uint8_t interval_millis;
+    uint32_t last_millis;
+    uint16_t drive_up, drive_down, brake_up, brake_down;
+    int32_t min_rpm;
+    uint16_t ramp_rpm;
+    uint8_t nudge_rpm;
+    int8_t cancel;
+    int32_t current;    // [mA] last current command, >0 motor, <0 brake
+    bool cruise_active;
+    bool cruise_locked; // cancelled by braking, until the button is released
+    int32_t cruise_rpm; // [erpm] set speed
+    int32_t rpm;        // [erpm] last rpm command
+};
+
+#endif
@@ -0,0 +1,88 @@
+// Please read PortBounce.h for information about the vertical counter
+
+#include "Arduino.h"
+#include "PortBounce.h"
+
+PortBounce::PortBounce()
+    : port(0)
+    , mask(0)
+    , invert(0)
+    , cnt0(0xFF)
+    , cnt1(0xFF)
+    , state(0)
+    , pressMask(0)
+    , releaseMask(0)
+    , longMask(0)
+    , doubleMask(0)
+    , longDone(0)
+    , clicked(0)
+    , interval_millis(5)
+    , long_millis(1000)
+    , double_millis(300)
+    , previous_millis(0)
+{}
+
+void PortBounce::attach(volatile uint8_t *port, uint8_t mask, uint8_t activeHigh)
+{
+    this->port = port;
+    this->mask = mask;
+    invert = ~activeHigh;
+    state = (*port ^ invert) & mask;
+    cnt0 = cnt1 = 0xFF;
+    previous_millis = millis();
+    for (uint8_t bit = 0; bit < 8; bit++)
+        edgeTime[bit] = previous_millis;
+}
+
+void PortBounce::interval(uint8_t interval_millis)
+{
+    this->interval_millis = interval_millis;
+}
+
+void PortBounce::timing(uint16_t long_millis, uint16_t double_millis)
+{
+    this->long_millis = long_millis;
+    this->double_millis = double_millis;
+}
+
+uint8_t PortBounce::update()
+{
+    pressMask = releaseMask = longMask = doubleMask = 0;
+    uint16_t now = millis();
+    if ((uint16_t)(now - previous_millis) < interval_millis)
+        return 0;
+    previous_millis = now;
+
+    // Count the bits that differ from the state, reset the others
+    uint8_t delta = state ^ ((*port ^ invert) & mask);
+    cnt0 = ~(cnt0 & delta);
+    cnt1 = cnt0 ^ (cnt1 & delta);
+    uint8_t toggle = delta & cnt0 & cnt1; // 4 equal samples
+    state ^= toggle;
+    pressMask = toggle & state;
+    releaseMask = toggle & ~state;
+
+    uint8_t held = state & ~longDone;
+    if (!(toggle | held))
+        return 0;
+    for (uint8_t bit = 0; bit < 8; bit++) {
+        uint8_t b = _BV(bit);
+        if (pressMask & b) {
+            if ((clicked & b) && (uint16_t)(now - edgeTime[bit]) <= double_millis)
+                doubleMask |= b;
+            clicked = (clicked & ~b) | (doubleMask & b); // a double click doesn't start the next one
+            longDone &= ~b;
+            edgeTime[bit] = now;
+        } else if (releaseMask & b) {
+            if (clicked & b || longDone & b)
+                clicked &= ~b;
+            else
+                clicked |= b;
+            edgeTime[bit] = now;
+        } else if ((held & b) && (uint16_t)(now - edgeTime[bit]) >= long_millis) {
+            longMask |= b;
+            longDone |= b;
+        }
+    }
+    return pressMask | releaseMask | longMask | doubleMask;
+}
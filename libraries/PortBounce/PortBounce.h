@@ -0,0 +1,82 @@
+/*
+  PortBounce - debounces all buttons of one port with a single read
+
+  Each update() reads the port once and debounces all 8 bits in parallel
+  with a vertical counter: bit n of cnt0 and cnt1 form a 2 bit counter for
+  pin n. A bit that differs from the debounced state counts up with every
+  sample, the state toggles after 4 equal samples. A bit that bounces back
+  resets its counter. At the default 5 ms sample interval a button has to be
+  stable for 20 ms.
+
+  Pins are given as bit numbers of the port, on an ATmega328 PIND bit n is
+  digital pin n. State and events are "pressed" based, activeHigh marks the
+  buttons that pull the pin up when pressed, all others are active low.
+
+  Events are valid until the next update():
+
+          pressed     debounced press
+          released    debounced release
+          longPress   held for longTime, once per press
+          doubleClick press within doubleTime after a short click
+
+  time() keeps the low 16 bits of millis() at the last edge, enough for any
+  button duration and 2 bytes per pin instead of 4.
+*/
+
+#ifndef PortBounce_h
+#define PortBounce_h
+
+#include <inttypes.h>
+
+#ifndef _BV
+#define _BV(n) (1<<(n))
+#endif
+
+class PortBounce
+{
+ public:
+    // Create an instance of the debouncer
+    PortBounce();
+
+    // Attach to the bits mask of an input port (e.g. &PIND), sets the initial state
+    void attach(volatile uint8_t *port, uint8_t mask, uint8_t activeHigh = 0);
+
+    // Sets the sample interval, 4 samples debounce
+    void interval(uint8_t interval_millis);
+
+    // Sets the hold time of a long press and the gap of a double click
+    void timing(uint16_t long_millis, uint16_t double_millis);
+
+    // Samples the port if the interval passed
+    // Returns the bits with a new event
+    uint8_t update();
+
+    // Returns the debounced state of a bit, 1 = pressed
+    bool read(uint8_t bit) { return state & _BV(bit); }
+
+    // Returns the event of a bit
+    bool pressed(uint8_t bit) { return pressMask & _BV(bit); }
+    bool released(uint8_t bit) { return releaseMask & _BV(bit); }
+    bool longPress(uint8_t bit) { return longMask & _BV(bit); }
+    bool doubleClick(uint8_t bit) { return doubleMask & _BV(bit); }
+
+    // Returns millis() (low 16 bit) of the last press or release of a bit
+    uint16_t time(uint8_t bit) { return edgeTime[bit]; }
+
+ protected:
+    volatile uint8_t *port;
+    uint8_t mask;
+    uint8_t invert;         // active low bits
+    uint8_t cnt0, cnt1;     // vertical counter
+    uint8_t state;          // debounced, 1 = pressed
+    uint8_t pressMask, releaseMask, longMask, doubleMask;
+    uint8_t longDone;       // long press reported for this press
+    uint8_t clicked;        // last press was a short click
+    uint8_t interval_millis;
+    uint16_t long_millis;
+    uint16_t double_millis;
+    uint16_t previous_millis;
+    uint16_t edgeTime[8];
+};
+
+#endif
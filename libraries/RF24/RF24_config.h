@@ -133,7 +133,11 @@
 
 #elif defined(ARDUINO) && ! defined(__arm__) && !defined (__ARDUINO_X86__) || defined(XMEGA)
 	#include <avr/pgmspace.h>
+	#ifdef HOST_BUILD // flash strings are ordinary strings on the host
+	#define PRIPSTR "%s"
+	#else
 	#define PRIPSTR "%S"
+	#endif
 #else
   #if ! defined(ARDUINO) // This doesn't work on Arduino DUE
 	typedef char const char;
@@ -0,0 +1,254 @@
+/*
+  LogFormat.h - layout of the LOGnnn.BIN ride logs
+
+  Shared by the firmware and the host tools in /tools, so it only uses
+  stdint types. All values are little endian, structures are packed.
+
+  File:   logHeader
+          logField[header.fields]   field table of the sample payload
+          uint16_t crc              over header and field table
+          frames...                 until the zero filled or erased end of the file
+
+  Frame:  logFrame                  starts with LOG_SYNC
+          uint8_t payload[len]
+          uint16_t crc              over frame and payload, without the sync byte
+
+  Every frame starts with the sync byte and carries its own CRC, so after
+  a torn write a reader scans for the next LOG_SYNC with a valid CRC and
+  continues from there.
+
+  LOG_REC_SAMPLE frames hold one complete sample (key frame). A
+  LOG_REC_DELTA frame holds the following samples, each encoded against
+  the sample before it:
+
+          varint  ms since the previous sample (frame.ms for the first one)
+          varint  mask, bit n set = field n of the field table changed
+          varint  zigzag(new - old) for every changed field, raw values
+                  (float fields as their bit pattern)
+
+  After a lost or bad frame the delta frames are useless until the next
+  key frame.
+
+  A LOG_REC_EVENT frame holds the LOG_EVT_ bits that fired. It is followed
+  by the samples the TX kept in RAM before the event: the oldest one as
+  LOG_REC_TICK frame and the ones after it in a LOG_REC_TICKS frame, delta
+  encoded like a LOG_REC_DELTA frame, starting from the LOG_REC_TICK and
+  its frame.ms. They are not part of the delta chain of the samples.
+*/
+
+#ifndef LogFormat_h
+#define LogFormat_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#ifdef __AVR__
+#include <util/crc16.h>
+#endif
+
+#define LOG_VERSION 2 // 2: LOG_REC_DELTA
+#define LOG_SYNC 0xA5
+#define LOG_NAME_LEN 18
+
+// Field types of the field table
+enum {
+    LOG_U8 = 1,
+    LOG_I8,
+    LOG_BOOL,
+    LOG_U16,
+    LOG_I16,
+    LOG_U32,
+    LOG_I32,
+    LOG_F32
+};
+
+// Frame types
+enum {
+    LOG_REC_SAMPLE = 1, // payload described by the field table
+    LOG_REC_DELTA,      // samples encoded against the sample before
+    LOG_REC_EVENT,      // uint8_t LOG_EVT_ bits
+    LOG_REC_TICK,       // payload like LOG_REC_SAMPLE, from before the event
+    LOG_REC_TICKS       // the samples after the LOG_REC_TICK, like LOG_REC_DELTA
+};
+
+// Event triggers
+#define LOG_EVT_LINK 0x01  // no acknowledged packet for a while
+#define LOG_EVT_RADIO 0x02 // several radio.write() failed in a row
+#define LOG_EVT_SAG 0x04   // battery voltage dropped
+#define LOG_EVT_SPIKE 0x08 // motor current above the limit
+#define LOG_EVT_BRAKE 0x10 // brake applied
+
+struct logHeader {
+    char magic[4];          // "EMTB"
+    uint8_t version;        // LOG_VERSION
+    uint8_t fields;         // number of logField entries after the header
+    uint16_t wheelsize;     // [mm]
+    uint8_t gearratio;      // [1:X]
+    uint8_t pulse_rpm;      // tacho pulses per motor revolution
+    uint8_t erpm_rpm;       // ERPM per motor RPM
+    float dist_corr_factor;
+    float ratio_RpmSpeed;   // ERPM to km/h
+    float ratio_TachoDist;  // tacho pulses to km
+} __attribute__((packed));
+
+struct logField {
+    char name[LOG_NAME_LEN]; // zero terminated
+    uint8_t type;            // LOG_U8 ...
+    uint8_t offset;          // byte offset in the payload
+    float scale;             // value = raw * scale
+} __attribute__((packed));
+
+struct logFrame {
+    uint8_t sync;  // LOG_SYNC
+    uint8_t type;  // LOG_REC_SAMPLE ...
+    uint8_t len;   // payload bytes following the frame
+    uint16_t seq;  // incremented for every frame, gaps show lost frames
+    uint32_t ms;   // millis() when the frame was written
+} __attribute__((packed));
+
+// Offset and type of a field, the part of logField the delta coder needs
+struct logSlot {
+    uint8_t offset;
+    uint8_t type;
+};
+
+// CRC-16/XMODEM, the same polynomial the VESC uses
+static inline uint16_t logCrc16(uint16_t crc, const void *data, uint16_t len)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    while (len--) {
+#ifdef __AVR__
+        crc = _crc_xmodem_update(crc, *p++);
+#else
+        crc ^= (uint16_t)*p++ << 8;
+        for (uint8_t i = 0; i < 8; i++)
+            crc = crc & 0x8000 ? (crc << 1) ^ 0x1021 : crc << 1;
+#endif
+    }
+    return crc;
+}
+
+static inline uint8_t logTypeSize(uint8_t type)
+{
+    switch (type) {
+    case LOG_U16:
+    case LOG_I16:
+        return 2;
+    case LOG_U32:
+    case LOG_I32:
+    case LOG_F32:
+        return 4;
+    default:
+        return 1;
+    }
+}
+
+// Raw field value, signed types are sign extended
+static inline uint32_t logGetRaw(const uint8_t *p, uint8_t type)
+{
+    switch (type) {
+    case LOG_I8:
+        return (int32_t)(int8_t)p[0];
+    case LOG_U16:
+        return p[0] | (uint16_t)p[1] << 8;
+    case LOG_I16:
+        return (int32_t)(int16_t)(p[0] | (uint16_t)p[1] << 8);
+    case LOG_U32:
+    case LOG_I32:
+    case LOG_F32:
+        return p[0] | (uint16_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+    default:
+        return p[0];
+    }
+}
+
+static inline void logPutRaw(uint8_t *p, uint8_t type, uint32_t v)
+{
+    uint8_t n = logTypeSize(type);
+    while (n--) {
+        *p++ = v;
+        v >>= 8;
+    }
+}
+
+static inline uint8_t *logPutVarint(uint8_t *p, uint32_t v)
+{
+    while (v > 0x7F) {
+        *p++ = (uint8_t)v | 0x80;
+        v >>= 7;
+    }
+    *p++ = v;
+    return p;
+}
+
+// Small positive and negative differences both become small numbers
+static inline uint32_t logZigzag(uint32_t v)
+{
+    return (v << 1) ^ (0 - (v >> 31));
+}
+
+static inline uint32_t logUnzigzag(uint32_t v)
+{
+    return (v >> 1) ^ (0 - (v & 1));
+}
+
+// Worst case size of one delta encoded sample
+#define LOG_DELTA_MAX(fields) (10 + 5 * (fields))
+
+// Appends sample cur, encoded against prev, to out and updates prev
+// Returns the new end of out
+static inline uint8_t *logEncodeDelta(uint8_t *out, uint32_t ms, const logSlot *slots, uint8_t n,
+                                      uint8_t *prev, const uint8_t *cur)
+{
+    uint32_t mask = 0, bit = 1;
+    uint8_t i;
+
+    for (i = 0; i < n; i++, bit <<= 1) {
+        if (memcmp(prev + slots[i].offset, cur + slots[i].offset, logTypeSize(slots[i].type)))
+            mask |= bit;
+    }
+    out = logPutVarint(out, ms);
+    out = logPutVarint(out, mask);
+    for (i = 0; mask; i++, mask >>= 1) {
+        if (!(mask & 1)) continue;
+        uint8_t *o = prev + slots[i].offset;
+        const uint8_t *c = cur + slots[i].offset;
+        out = logPutVarint(out, logZigzag(logGetRaw(c, slots[i].type) - logGetRaw(o, slots[i].type)));
+        memcpy(o, c, logTypeSize(slots[i].type));
+    }
+    return out;
+}
+
+// Reads a varint of a buffer of the encoder, no end is checked
+static inline const uint8_t *logTakeVarint(const uint8_t *p, uint32_t *v)
+{
+    uint32_t x = 0;
+    uint8_t shift = 0;
+
+    do {
+        x |= (uint32_t)(*p & 0x7F) << shift;
+        shift += 7;
+    } while (*p++ & 0x80);
+    *v = x;
+    return p;
+}
+
+// Applies one sample of logEncodeDelta() to sample and adds its time to ms
+// Returns the start of the next one
+static inline const uint8_t *logApplyDelta(const uint8_t *in, uint32_t *ms, const logSlot *slots, uint8_t *sample)
+{
+    uint32_t v, mask;
+
+    in = logTakeVarint(in, &v);
+    *ms += v;
+    in = logTakeVarint(in, &mask);
+    for (uint8_t i = 0; mask; i++, mask >>= 1) {
+        if (!(mask & 1)) continue;
+        in = logTakeVarint(in, &v);
+        uint8_t *o = sample + slots[i].offset;
+        logPutRaw(o, slots[i].type, logGetRaw(o, slots[i].type) + logUnzigzag(v));
+    }
+    return in;
+}
+
+#endif
@@ -0,0 +1,330 @@
+// Please read SDLog.h for information about the file layout
+
+#include "Arduino.h"
+#include "SDLog.h"
+
+// Largest LOG_REC_DELTA frame. Every write keeps room for one behind it in
+// the extent, so the one sync() closes always fits.
+static const uint32_t deltaFrame = sizeof(logFrame) + SDLOG_BLOCK + 2;
+
+SDLog::SDLog()
+    : buffer(0)
+    , first(0)
+    , sector(0)
+    , sectors(0)
+    , extent(0)
+    , number(0)
+    , header_len(0)
+    , sector_writes(0)
+    , sequence(0)
+    , max_micros(0)
+    , previous_millis(0)
+    , interval_millis(5000)
+    , fill(0)
+    , dirty(false)
+    , slot_count(0)
+    , sample_size(0)
+    , key_interval(40)
+    , key_count(0)
+    , block_fill(0)
+{}
+
+// Number of a LOGnnn.BIN name, -1 for other files
+static int16_t logNumber(const char *name)
+{
+    if (strncmp(name, "LOG", 3) || strcmp(name + 6, ".BIN")) return -1;
+    for (uint8_t i = 3; i < 6; i++)
+        if (name[i] < '0' || name[i] > '9') return -1;
+    return (name[3] - '0') * 100 + (name[4] - '0') * 10 + name[5] - '0';
+}
+
+bool SDLog::begin(uint16_t sectors)
+{
+    int16_t n = -1;
+
+    // One pass over the directory instead of an exists() search per name
+    File root = SD.open("/");
+    if (!root) return false;
+    for (File entry = root.openNextFile(); entry; entry = root.openNextFile()) {
+        int16_t number = logNumber(entry.name());
+        if (number > n) n = number;
+        entry.close();
+    }
+    root.close();
+
+    number = n + 1;
+    extent = sectors;
+    if (!create()) return false;
+    previous_millis = millis();
+    return true;
+}
+
+// Creates LOGnnn.BIN of number as one contiguous, erased extent
+// and takes the block cache of the SD library as sector buffer
+bool SDLog::create()
+{
+    char name[] = "LOG000.BIN";
+    SdVolume volume;
+    SdFile root;
+    SdFile file;
+    uint32_t last;
+    uint16_t size = extent;
+
+    buffer = 0;
+    if (number > 999) return false;
+    name[3] = '0' + number / 100;
+    name[4] = '0' + (number / 10) % 10;
+    name[5] = '0' + number % 10;
+
+    if (!volume.init(SdVolume::sdCard()) || !root.openRoot(&volume)) return false;
+    while (!file.createContiguous(&root, name, (uint32_t)size * SDLOG_SECTOR)) {
+        size /= 2;
+        if (size < SDLOG_EXTENT_MIN) return false;
+    }
+    file.contiguousRange(&first, &last);
+    file.close();
+    root.close();
+
+    // The blocks still hold old data, old frames would read as part of this log
+    if (!SdVolume::sdCard()->erase(first, last)) return false;
+    // Writes back the directory and FAT blocks, from here on the logger owns the cache
+    buffer = SdVolume::cacheClear();
+    if (!buffer) return false;
+
+    memset(buffer, 0, SDLOG_SECTOR);
+    sectors = last - first + 1;
+    sector = 0;
+    fill = 0;
+    dirty = false;
+    return true;
+}
+
+// Continues the log in the next LOGnnn.BIN, that starts with the same header
+bool SDLog::nextExtent()
+{
+    uint32_t header = first;
+
+    number++;
+    if (!create()) return false;
+    // Header, field table and CRC are at the start of the first sector of the last extent
+    if (header_len > SDLOG_SECTOR || !SdVolume::sdCard()->readBlock(header, buffer)) {
+        buffer = 0;
+        return false;
+    }
+    memset(buffer + header_len, 0, SDLOG_SECTOR - header_len);
+    fill = header_len;
+    dirty = fill != 0;
+    key_count = 0; // the delta chain starts again with a key frame
+    return true;
+}
+
+// Moves to the next extent if len more bytes, a delta frame behind them and
+// the open delta frame could reach past the end of this one
+bool SDLog::roll(uint16_t len)
+{
+    if (!buffer || (uint32_t)(sectors - sector) * SDLOG_SECTOR - fill >= len + 2 * deltaFrame)
+        return false;
+
+    closeBlock();
+    if (dirty) writeSector();
+
+    unsigned long start = micros();
+    nextExtent();
+    unsigned long duration = micros() - start;
+    if (duration > max_micros) max_micros = duration;
+    return true;
+}
+
+void SDLog::syncInterval(uint16_t interval_millis)
+{
+    this->interval_millis = interval_millis;
+}
+
+void SDLog::keyInterval(uint8_t samples)
+{
+    key_interval = samples;
+}
+
+bool SDLog::write(const void *data, uint16_t len)
+{
+    bool written = roll(len);
+    written |= append(data, len);
+    return written || syncDue();
+}
+
+bool SDLog::writeHeader(logHeader *header, const logField *fields)
+{
+    logField field;
+    uint16_t crc;
+    bool written;
+
+    memcpy(header->magic, "EMTB", 4);
+    header->version = LOG_VERSION;
+    crc = logCrc16(0, header, sizeof(logHeader));
+    written = append(header, sizeof(logHeader));
+    sample_size = 0;
+    for (uint8_t i = 0; i < header->fields; i++) {
+        memcpy_P(&field, fields + i, sizeof(logField));
+        crc = logCrc16(crc, &field, sizeof(logField));
+        written |= append(&field, sizeof(logField));
+        if (i < SDLOG_FIELDS) {
+            slots[i].offset = field.offset;
+            slots[i].type = field.type;
+        }
+        if (field.offset + logTypeSize(field.type) > sample_size)
+            sample_size = field.offset + logTypeSize(field.type);
+    }
+    written |= append(&crc, sizeof(crc));
+    header_len = sector ? SDLOG_SECTOR + 1 : fill; // only one that fits the first sector is repeated
+
+    slot_count = header->fields;
+    if (slot_count > SDLOG_FIELDS || sample_size > SDLOG_SAMPLE)
+        slot_count = 0;
+    key_count = 0;
+    block_fill = 0;
+    return written || syncDue();
+}
+
+bool SDLog::writeRecord(uint8_t type, const void *data, uint8_t len)
+{
+    bool written = roll(sizeof(logFrame) + len + 2);
+    written |= writeFrame(type, data, len, millis());
+    return written || syncDue();
+}
+
+bool SDLog::writeSample(const void *sample)
+{
+    uint32_t now = millis();
+    bool written = roll(sizeof(logFrame) + sample_size + 2);
+
+    if (!slot_count || !key_count) {
+        // Key frame, the reference for the following delta samples
+        written |= closeBlock();
+        written |= writeFrame(LOG_REC_SAMPLE, sample, sample_size, now);
+        if (slot_count) memcpy(prev, sample, sample_size);
+        key_count = key_interval;
+    } else {
+        // Encoded straight into the frame, so it has to have room for the worst case
+        if (block_fill + LOG_DELTA_MAX(slot_count) > SDLOG_BLOCK)
+            written |= closeBlock();
+        if (!block_fill)
+            block_ms = last_ms;
+        block_fill = logEncodeDelta(block + block_fill, now - last_ms, slots, slot_count, prev, (const uint8_t *)sample) - block;
+        key_count--;
+    }
+    last_ms = now;
+    return written || syncDue();
+}
+
+bool SDLog::writeTicks(uint8_t events, const void *sample, uint32_t ms, const void *deltas, uint8_t len)
+{
+    // All in one extent, the deltas are no use without their sample
+    bool written = roll(3 * (sizeof(logFrame) + 2) + 1 + sample_size + len);
+    written |= writeFrame(LOG_REC_EVENT, &events, 1, millis());
+    written |= writeFrame(LOG_REC_TICK, sample, sample_size, ms);
+    if (len) written |= writeFrame(LOG_REC_TICKS, deltas, len, ms);
+    return written || syncDue();
+}
+
+uint8_t SDLog::deltaSlots(const logSlot **slots)
+{
+    *slots = this->slots;
+    return slot_count;
+}
+
+void SDLog::sync()
+{
+    previous_millis = millis();
+    if (!buffer) return;
+    closeBlock();
+    if (dirty) writeSector(); // the open sector is written again once it is full
+}
+
+bool SDLog::append(const void *data, uint16_t len)
+{
+    const uint8_t *src = (const uint8_t *)data;
+    bool written = false;
+
+    // roll() keeps the frames inside the extent, only a raw write() can reach its end
+    while (len && buffer && sector < sectors) {
+        uint16_t n = SDLOG_SECTOR - fill;
+        if (n > len) n = len;
+        memcpy(buffer + fill, src, n);
+        fill += n;
+        src += n;
+        len -= n;
+        dirty = true;
+
+        if (fill == SDLOG_SECTOR) {
+            writeSector();
+            sector++;
+            fill = 0;
+            memset(buffer, 0, SDLOG_SECTOR); // a partial sector is written zero padded
+            written = true;
+        }
+    }
+    return written;
+}
+
+bool SDLog::writeFrame(uint8_t type, const void *data, uint8_t len, uint32_t ms)
+{
+    logFrame frame;
+    uint16_t crc;
+    bool written;
+
+    frame.sync = LOG_SYNC;
+    frame.type = type;
+    frame.len = len;
+    frame.seq = sequence++;
+    frame.ms = ms;
+    crc = logCrc16(0, &frame.type, sizeof(logFrame) - 1);
+    crc = logCrc16(crc, data, len);
+
+    written = append(&frame, sizeof(logFrame));
+    written |= append(data, len);
+    written |= append(&crc, sizeof(crc));
+    return written;
+}
+
+bool SDLog::closeBlock()
+{
+    uint8_t len = block_fill;
+
+    if (!len) return false;
+    block_fill = 0;
+    return writeFrame(LOG_REC_DELTA, block, len, block_ms);
+}
+
+bool SDLog::syncDue()
+{
+    if (millis() - previous_millis < interval_millis) return false;
+    sync();
+    return true;
+}
+
+void SDLog::writeSector()
+{
+    unsigned long start = micros();
+
+    SdVolume::sdCard()->writeBlock(first + sector, buffer);
+    sector_writes++;
+    dirty = false;
+
+    unsigned long duration = micros() - start;
+    if (duration > max_micros) max_micros = duration;
+}
+
+uint32_t SDLog::maxLatency()
+{
+    return max_micros;
+}
+
+void SDLog::resetLatency()
+{
+    max_micros = 0;
+}
+
+uint32_t SDLog::sectorWrites()
+{
+    return sector_writes;
+}
@@ -0,0 +1,144 @@
+/*
+  SDLog - block buffered logger for the SD card
+
+  Records are collected in a 512 byte sector buffer and the card is only
+  written in whole sectors, with raw block writes of Sd2Card. The buffer
+  is the block cache of the SD library (SdVolume::cacheClear()), the
+  logger has no second 512 bytes of its own. After begin() the cache
+  belongs to the logger, no other SD calls may follow while it logs.
+
+  begin() creates the LOGnnn.BIN after the highest one on the card, found
+  with one pass over the directory, as one contiguous file of the given
+  number of sectors and erases it. A card without room for that gets the
+  largest half that fits. Every sector is written in place inside this
+  extent with one block write: the FAT and the directory entry are never
+  touched while riding, the file has its size from the start. The erased
+  rest reads as 0x00 or 0xFF, depending on the card.
+
+  When the extent runs out the log goes on in the next LOGnnn.BIN, one
+  more extent that starts with the same header (it has to fit into the
+  first sector, 20 fields) and a key frame. No frame is split between two
+  files, every file reads on its own.
+
+  The open (partial) sector is written every syncInterval(), so a power
+  cut only loses the records of that interval.
+
+  writeHeader() and writeRecord() put the self describing header and the
+  framed records of LogFormat.h into the log. writeSample() stores every
+  keyInterval() samples a key frame and the samples in between delta
+  encoded, collected in LOG_REC_DELTA frames of up to SDLOG_BLOCK bytes.
+*/
+
+#ifndef SDLog_h
+#define SDLog_h
+
+#include <inttypes.h>
+#include <SD.h>
+#include "LogFormat.h"
+
+#define SDLOG_SECTOR 512
+#define SDLOG_FIELDS 18  // more fields or a larger sample are logged as key frames only
+#define SDLOG_SAMPLE 40
+#define SDLOG_BLOCK 100  // payload of a LOG_REC_DELTA frame, at least LOG_DELTA_MAX(SDLOG_FIELDS)
+#define SDLOG_EXTENT_MIN 4 // sectors, a card with less room gets no log
+
+#if LOG_DELTA_MAX(SDLOG_FIELDS) > SDLOG_BLOCK
+#error "SDLOG_BLOCK has to hold one delta sample of SDLOG_FIELDS fields"
+#endif
+
+class SDLog
+{
+ public:
+    // Create an instance of the logger
+    SDLog();
+
+    // Create the next LOGnnn.BIN as one erased extent of sectors * 512 bytes
+    // SD.begin() has to be called first
+    // Returns 0 if no file could be created or erased
+    bool begin(uint16_t sectors);
+
+    // Sets the interval after which the open sector is written
+    void syncInterval(uint16_t interval_millis);
+
+    // Appends a record, a full sector is written to the card at once
+    // A sync that falls due in a call that filled a sector waits for the next call,
+    // so a record of less than a sector costs one sector write at most
+    // Returns 1 if the card was written (sector full or sync due)
+    // Returns 0 if the record only went into the buffer
+    bool write(const void *data, uint16_t len);
+
+    // Writes header, field table and header CRC, fields points to PROGMEM
+    // magic and version are filled in here
+    bool writeHeader(logHeader *header, const logField *fields);
+
+    // Sets the number of delta encoded samples between two key frames
+    void keyInterval(uint8_t samples);
+
+    // Appends one sample as described by the field table of writeHeader()
+    // Returns like write()
+    bool writeSample(const void *sample);
+
+    // Appends a LOG_REC_EVENT frame with events and the samples kept before it, outside
+    // the delta chain: sample taken at ms as LOG_REC_TICK frame, the ones after it as
+    // LOG_REC_TICKS frame of len bytes deltas, encoded with logEncodeDelta() and the slots
+    // of deltaSlots(). The three frames are one record of write(), one sector write at most
+    // Returns like write()
+    bool writeTicks(uint8_t events, const void *sample, uint32_t ms, const void *deltas, uint8_t len);
+
+    // Points slots to the fields of writeHeader() for logEncodeDelta()
+    // Returns their number, 0 if samples are only logged whole
+    uint8_t deltaSlots(const logSlot **slots);
+
+    // Appends one frame with sequence number, timestamp and CRC
+    // Returns like write()
+    bool writeRecord(uint8_t type, const void *data, uint8_t len);
+
+    // Writes the open delta frame and sector
+    void sync();
+
+    // Longest sector write or change of extent in microseconds since the last resetLatency()
+    uint32_t maxLatency();
+
+    void resetLatency();
+
+    // Number of sector writes to the card, rewrites of the open sector included
+    uint32_t sectorWrites();
+
+ protected:
+    bool append(const void *data, uint16_t len);
+    bool writeFrame(uint8_t type, const void *data, uint8_t len, uint32_t ms);
+    bool closeBlock();
+    bool syncDue();
+    void writeSector();
+    bool create();
+    bool nextExtent();
+    bool roll(uint16_t len);
+
+    uint8_t *buffer;          // block cache of the SD library, 0 = not logging
+    uint32_t first;           // card block of the first sector of the extent
+    uint16_t sector;          // sector of the extent the buffer belongs to
+    uint16_t sectors;         // sectors in the extent
+    uint16_t extent;          // sectors asked for in begin()
+    uint16_t number;          // of the LOGnnn.BIN
+    uint16_t header_len;      // bytes of header, field table and CRC
+    uint32_t sector_writes;
+    uint16_t sequence;
+    uint32_t max_micros;
+    unsigned long previous_millis;
+    uint16_t interval_millis;
+    uint16_t fill;            // bytes used in buffer
+    bool dirty;               // buffer holds records that are not on the card yet
+
+    logSlot slots[SDLOG_FIELDS];
+    uint8_t slot_count;       // 0 = only key frames
+    uint8_t sample_size;
+    uint8_t key_interval;
+    uint8_t key_count;        // delta samples until the next key frame
+    uint8_t block_fill;
+    uint32_t block_ms;        // ms of the sample before the open delta frame
+    uint32_t last_ms;         // ms of prev
+    uint8_t prev[SDLOG_SAMPLE];
+    uint8_t block[SDLOG_BLOCK];
+};
+
+#endif
@@ -0,0 +1,72 @@
+#!/usr/bin/env python
+# Font subset generator for the TFT_ST7735 fonts
+#
+# Reads one of the full font files (e.g. Font32rleOriginal.c) and writes a font file
+# that only keeps the glyphs of the given characters. All other characters point to
+# the space glyph, so the 96 entry width and pointer tables stay directly indexed
+# with (character - 32) and drawChar() needs no extra lookup.
+#
+# Usage: python subset.py <font source> <characters> > <subset font>
+#   python subset.py Font32rleOriginal.c " ,-.0123456789" > Font32rle.c
+#
+# The flash used by the glyph data before and after is printed to stderr.
+
+import re
+import sys
+
+FIRST_CHR = 32
+NR_CHRS = 96
+
+
+def parse(source):
+    # Glyph arrays are named chr_<font>_<hex code>, e.g. chr_f32_30 for '0'
+    glyphs = {}
+    for name, code, body in re.findall(r"PROGMEM const unsigned char (chr_\w+?_([0-9A-F]{2}))\[\d*\]\s*=[^{]*\{(.*?)\};", source, re.S):
+        glyphs[int(code, 16)] = (name, [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]+", body)])
+    fontid = re.search(r"widtbl_(\w+)\[", source).group(1)
+    widths = re.search(r"widtbl_\w+\[\d+\]\s*=[^{]*\{(.*?)\};", source, re.S).group(1)
+    widths = [int(v) for v in re.findall(r"\b\d+\b", re.sub(r"//.*", "", widths))]
+    header = source[:source.index("PROGMEM")]
+    return fontid, header, widths, glyphs
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.stderr.write("Usage: python subset.py <font source> <characters>\n")
+        sys.exit(1)
+
+    source = open(sys.argv[1]).read()
+    fontid, header, widths, glyphs = parse(source)
+    keep = set(ord(c) for c in sys.argv[2]) | set([FIRST_CHR])  # Space is the fallback glyph
+    keep = sorted(c for c in keep if c in glyphs)
+
+    out = [header.rstrip("\n") + "\n"]
+    out.append("// Subset generated by subset.py, characters: %s\n\n" % "".join(chr(c) for c in keep))
+    out.append("PROGMEM const unsigned char widtbl_%s[%d] =         // character width table\n{\n" % (fontid, NR_CHRS))
+    for row in range(0, NR_CHRS, 8):
+        out.append("        %s%s       // char %d - %d\n" % (", ".join(str(w) for w in widths[row:row + 8]),
+                                                        "," if row + 8 < NR_CHRS else " ", FIRST_CHR + row, FIRST_CHR + row + 7))
+    out.append("};\n\n// Row format, MSB left\n")
+
+    for c in keep:
+        name, data = glyphs[c]
+        out.append("\nPROGMEM const unsigned char %s[] = \n{\n" % name)
+        for i in range(0, len(data), 8):
+            out.append(", ".join("0x%02X" % v for v in data[i:i + 8]) + (",\n" if i + 8 < len(data) else "\n"))
+        out.append("};\n")
+
+    out.append("\nPROGMEM const unsigned char* const chrtbl_%s[%d] =       // character pointer table\n{\n" % (fontid, NR_CHRS))
+    names = [glyphs[c if c in keep else FIRST_CHR][0] for c in range(FIRST_CHR, FIRST_CHR + NR_CHRS)]
+    for row in range(0, NR_CHRS, 8):
+        out.append("        %s%s\n" % (", ".join(names[row:row + 8]), "," if row + 8 < NR_CHRS else ""))
+    out.append("};\n")
+    sys.stdout.write("".join(out))
+
+    before = sum(len(d) for _, d in glyphs.values())
+    after = sum(len(glyphs[c][1]) for c in keep)
+    sys.stderr.write("%s: %d of %d glyphs, glyph data %d -> %d bytes, %d bytes of flash saved\n"
+                     % (fontid, len(keep), len(glyphs), before, after, before - after))
+
+
+if __name__ == "__main__":
+    main()
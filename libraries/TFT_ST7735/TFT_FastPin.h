@@ -304,8 +304,8 @@ _DEFPIN_AVR(0, 0x01, A); _DEFPIN_AVR(1, 0x02, A); _DEFPIN_AVR(2, 0x04, A); _DEFP
 _DEFPIN_AVR(4, 0x10, A); _DEFPIN_AVR(5, 0x20, A); _DEFPIN_AVR(6, 0x40, A); _DEFPIN_AVR(7, 0x80, A);
 _DEFPIN_AVR(8, 0x04, B); _DEFPIN_AVR(9, 0x02, B); _DEFPIN_AVR(10, 0x01, B);
 
-#elif defined(__AVR_ATmega328P__) || defined(__AVR_ATmega168__)
-// Accelerated port definitions for arduino avrs
+#elif defined(__AVR_ATmega328P__) || defined(__AVR_ATmega168__) || defined(HOST_BUILD)
+// Accelerated port definitions for arduino avrs, and the ATmega328 registers of the host build
 _IO(D); _IO(B); _IO(C);
 _DEFPIN_AVR( 0, 0x01, D); _DEFPIN_AVR( 1, 0x02, D); _DEFPIN_AVR( 2, 0x04, D); _DEFPIN_AVR( 3, 0x08, D);
 _DEFPIN_AVR( 4, 0x10, D); _DEFPIN_AVR( 5, 0x20, D); _DEFPIN_AVR( 6, 0x40, D); _DEFPIN_AVR( 7, 0x80, D);
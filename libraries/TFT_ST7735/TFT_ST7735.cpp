@@ -23,6 +23,14 @@
 #include "wiring_private.h"
 #include <SPI.h>
 
+// Counters for the SPI statistics, see SPI_STATS in User_Setup.h
+#ifdef SPI_STATS
+  static uint32_t statCommands, statBytes;
+  #define SPI_STAT(commands, bytes) { statCommands += (commands); statBytes += (bytes); }
+#else
+  #define SPI_STAT(commands, bytes)
+#endif
+
 inline void spiWait17(void) __attribute__((always_inline));
 inline void spiWait15(void) __attribute__((always_inline));
 inline void spiWait14(void) __attribute__((always_inline));
@@ -31,6 +39,9 @@ inline void spiWrite16(uint16_t data, int16_t count) __attribute__((always_inlin
 inline void spiWrite16s(uint16_t data) __attribute__((always_inline));
 inline void spiWrite16R(uint16_t data, int16_t count) __attribute__((always_inline));
 
+// Longest character row that can be buffered for scaled block writes is 64 pixels
+#define TFT_ROW_BYTES 8
+
 /***************************************************************************************
 ** Function name:           TFT_ST7735
 ** Description:             Constructor , we must use hardware SPI pins
@@ -68,6 +79,7 @@ TFT_ST7735::TFT_ST7735(int16_t w, int16_t h)
 
   addr_row = 0xFF;
   addr_col = 0xFF;
+  rle_font = 0; // No RLE font descriptor cached yet
 
 #ifdef LOAD_GLCD
   fontsloaded = 0x0002; // Bit 1 set
@@ -101,12 +113,12 @@ TFT_ST7735::TFT_ST7735(int16_t w, int16_t h)
 ***************************************************************************************/
 void TFT_ST7735::spiwrite(uint8_t c)
 {
-  savedSPCR = SPCR;
+  uint8_t spcr = SPCR; // Local copy so a backupSPCR() value is not overwritten
   SPCR = mySPCR;
   SPDR = c;
   asm volatile( "nop\n\t" ::); // Sync SPIF
   while (!(SPSR & _BV(SPIF)));
-  SPCR = savedSPCR;
+  SPCR = spcr;
 }
 
 /***************************************************************************************
@@ -115,6 +127,7 @@ void TFT_ST7735::spiwrite(uint8_t c)
 ***************************************************************************************/
 void TFT_ST7735::writecommand(uint8_t c)
 {
+  SPI_STAT(1, 0);
   TFT_DC_C;
   TFT_CS_L;
   spiwrite(c);
@@ -127,6 +140,7 @@ void TFT_ST7735::writecommand(uint8_t c)
 ***************************************************************************************/
 void TFT_ST7735::writedata(uint8_t c)
 {
+  SPI_STAT(0, 1);
   TFT_DC_D;
   TFT_CS_L;
   spiwrite(c);
@@ -145,9 +159,13 @@ void TFT_ST7735::writeEnd() {
 ** Function name:           backupSPCR
 ** Description:             Save the SPCR register so it can be restored
 ***************************************************************************************/
+// Also sets the SPI clock doubler, the delay based SPI loops rely on the TFT clock rate.
+// Call this before drawing when other devices (radio, SD) share the SPI bus
 void TFT_ST7735::backupSPCR() {
   savedSPCR = SPCR;
+  savedSPSR = SPSR & _BV(SPI2X);
   SPCR = mySPCR;
+  SPSR = mySPSR;
 }
 
 /***************************************************************************************
@@ -156,6 +174,7 @@ void TFT_ST7735::backupSPCR() {
 ***************************************************************************************/
 void TFT_ST7735::restoreSPCR() {
  SPCR = savedSPCR;
+ SPSR = savedSPSR;
 }
 
 /***************************************************************************************
@@ -216,6 +235,7 @@ void TFT_ST7735::init(void)
   SPI.setBitOrder(MSBFIRST);
   SPI.setDataMode(SPI_MODE0);
   mySPCR = SPCR;
+  mySPSR = SPSR & _BV(SPI2X);
 
   spi_end();
 
@@ -985,6 +1005,7 @@ spi_begin();
     byte column[6];
     byte mask = 0x1;
     setWindow(x, y, x+5, y+8);
+    SPI_STAT(0, 6 * 8 * 2);
     for (int8_t i = 0; i < 5; i++ ) column[i] = pgm_read_byte(font + (c * 5) + i);
     column[5] = 0;
 
@@ -1067,6 +1088,7 @@ void TFT_ST7735::setAddrWindow(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
 
 void TFT_ST7735::setWindow(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
 {
+  SPI_STAT(3, 8);
 
   addr_row = 0xFF;
   addr_col = 0xFF;
@@ -1118,6 +1140,7 @@ void TFT_ST7735::drawPixel(uint16_t x, uint16_t y, uint16_t color)
   TFT_CS_L;
 
 if (addr_col != x) {
+  SPI_STAT(1, 2);
   SPDR = ST7735_CASET;
   spiWait12();
   addr_col = x;
@@ -1131,6 +1154,7 @@ if (addr_col != x) {
 }
 
 if (addr_row != y) {
+  SPI_STAT(1, 2);
   SPDR = ST7735_RASET;
   spiWait12();
   addr_row = y;
@@ -1144,6 +1168,7 @@ if (addr_row != y) {
 }
 
   SPDR = ST7735_RAMWR; spiWait15();
+  SPI_STAT(1, 2);
 
   TFT_DC_D;
 
@@ -1161,6 +1186,7 @@ if (addr_row != y) {
 ***************************************************************************************/
 void TFT_ST7735::pushColor(uint16_t color)
 {
+  SPI_STAT(0, 2);
   spi_begin();
 
   TFT_CS_L;
@@ -1208,6 +1234,7 @@ void TFT_ST7735::pushColor(uint16_t color, uint16_t len)
 void TFT_ST7735::pushColors(uint16_t *data, uint8_t len)
 {
   uint16_t color;
+  SPI_STAT(0, len * 2);
   spi_begin();
 
   TFT_CS_L;
@@ -1217,6 +1244,7 @@ void TFT_ST7735::pushColors(uint16_t *data, uint8_t len)
     SPDR = color >> 8;
     spiWait17(); // Wait 17 clock cycles
     SPDR = color;
+#ifdef __AVR__
     // Wait 9 clock cycles
     asm volatile
     (
@@ -1225,6 +1253,9 @@ void TFT_ST7735::pushColors(uint16_t *data, uint8_t len)
       "1:	ret    \n"	//
       "2:	       \n"	//
     );
+#else
+    while (!(SPSR & _BV(SPIF)));
+#endif
   }
   while (!(SPSR & _BV(SPIF)));
 
@@ -1241,12 +1272,14 @@ void TFT_ST7735::pushColors(uint16_t *data, uint8_t len)
 
 void TFT_ST7735::pushColors(uint8_t *data, uint16_t len)
 {
+  SPI_STAT(0, len * 2);
   spi_begin();
   len = len<<1;
 
   TFT_CS_L;
   while (len--) {
     SPDR = *(data++);
+#ifdef __AVR__
     // Wait 11 clock cycles
     asm volatile
     (
@@ -1256,6 +1289,9 @@ void TFT_ST7735::pushColors(uint8_t *data, uint16_t len)
       "1:	ret    \n"	//
       "2:	       \n"	//
     );
+#else
+    while (!(SPSR & _BV(SPIF)));
+#endif
   }
   TFT_CS_H;
 
@@ -1670,15 +1706,53 @@ size_t TFT_ST7735::write(uint8_t uniCode)
   return 1;
 }
 
+/***************************************************************************************
+** Function name:           pushScaledRow
+** Description:             send one row of a character bitmap textsize times
+***************************************************************************************/
+// Chip select must be low and the address window set. Bits are MSB left, every bit
+// becomes textsize pixels and runs of equal bits are sent with one spiWrite16()
+void TFT_ST7735::pushScaledRow(uint8_t *rowbits, uint8_t width)
+{
+  uint8_t ts = textsize;
+  while (ts--)
+  {
+    uint8_t k = 0;
+    while (k < width)
+    {
+      boolean on = rowbits[k >> 3] & (0x80 >> (k & 7));
+      uint8_t run = 0;
+      while ((k < width) && (on == ((rowbits[k >> 3] & (0x80 >> (k & 7))) != 0))) {
+        run++;
+        k++;
+      }
+      spiWrite16(on ? textcolor : textbgcolor, run * textsize);
+    }
+  }
+}
+
 /***************************************************************************************
 ** Function name:           drawChar
 ** Description:             draw a unicode onto the screen
 ***************************************************************************************/
-int TFT_ST7735::drawChar(unsigned int uniCode, int x, int y, int font)
+int16_t TFT_ST7735::drawChar(unsigned int uniCode, int x, int y, int font)
+{
+  return drawCharRows(uniCode, x, y, font, 0, 255);
+}
+
+/***************************************************************************************
+** Function name:           drawCharRows
+** Description:             draw the glyph rows first to end - 1 of a unicode
+***************************************************************************************/
+// A glyph can be painted in bands of rows, each call sends only its own rows. Only
+// glyphs with a background colour are banded, the others are drawn whole with the
+// band that starts at row 0. Returns the width of the whole glyph like drawChar()
+int16_t TFT_ST7735::drawCharRows(unsigned int uniCode, int x, int y, int font, uint8_t first, uint8_t end)
 {
 
   if (font==1)
   {
+      if (first) return 6 * textsize;
 #ifdef LOAD_GLCD
       drawChar(x, y, uniCode, textcolor, textbgcolor, textsize);
       return 6 * textsize;
@@ -1689,7 +1763,7 @@ int TFT_ST7735::drawChar(unsigned int uniCode, int x, int y, int font)
 
   unsigned int width  = 0;
   unsigned int height = 0;
-  unsigned int flash_address = 0; // 16 bit address OK for Arduino if font files <60K
+  uintptr_t flash_address = 0; // 16 bit address OK for Arduino if font files <60K
   uniCode -= 32;
 
 #ifdef LOAD_FONT2
@@ -1705,12 +1779,30 @@ int TFT_ST7735::drawChar(unsigned int uniCode, int x, int y, int font)
   #endif
 #endif
 
+#if defined(LOAD_FONT4) && defined(LOAD_RLE) // Font 4 is RLE encoded, the else needs the block below
+  if (font == 4)
+  {
+      // Same direct table access as font 2, saves the pgm_read_word() through fontdata
+      flash_address = pgm_read_word(&chrtbl_f32[uniCode]);
+      width = pgm_read_byte(widtbl_f32 + uniCode);
+      height = chr_hgt_f32;
+  }
+  else
+#endif
+
 #ifdef LOAD_RLE
   {
-      // This is slower than above but is more convenient for the RLE fonts
-      flash_address = pgm_read_word( pgm_read_word( &(fontdata[font].chartbl ) ) + uniCode*sizeof(void *) );
-      width = pgm_read_byte( pgm_read_word( &(fontdata[font].widthtbl ) ) + uniCode );
-      height= pgm_read_byte( &fontdata[font].height );
+      // The font descriptor is only fetched from fontdata when the font changes,
+      // so a string costs one pgm_read_word() per table instead of two per character
+      if (font != rle_font) {
+        rle_chrtbl = (const unsigned char *)pgm_read_word( &(fontdata[font].chartbl ) );
+        rle_widtbl = (const unsigned char *)pgm_read_word( &(fontdata[font].widthtbl ) );
+        rle_height = pgm_read_byte( &fontdata[font].height );
+        rle_font = font;
+      }
+      flash_address = pgm_read_word( (const unsigned char * const *)rle_chrtbl + uniCode );
+      width = pgm_read_byte( rle_widtbl + uniCode );
+      height= rle_height;
   }
 #endif
 
@@ -1724,14 +1816,35 @@ int TFT_ST7735::drawChar(unsigned int uniCode, int x, int y, int font)
   byte bl = textbgcolor;
   byte bh = textbgcolor >> 8;
 
+  if (end > height) end = height;
+  if (first >= end) return width * textsize;
+
 #ifdef LOAD_FONT2 // chop out 962 bytes of code if we do not need it
   if (font == 2) {
     w = w + 6; // Should be + 7 but we need to compensate for width increment
     w = w / 8;
     if (x + width * textsize >= _width) return width * textsize ;
 
-    if (textcolor == textbgcolor || textsize != 1) {
+    if (textcolor != textbgcolor && textsize != 1)
+      // Scaled characters and background in one block write, each row is sent textsize times
+    {
+      byte rowbits[TFT_ROW_BYTES];
+      spi_begin();
+      setWindow(x, y + first * textsize, x + width * textsize - 1, y + end * textsize - 1);
 
+      for (int i = first; i < end; i++)
+      {
+        for (int k = 0; k < w; k++) rowbits[k] = pgm_read_byte(flash_address + w * i + k);
+        rowbits[w] = 0; // Width can be one pixel more than the bytes hold
+        pushScaledRow(rowbits, width);
+      }
+      while (!(SPSR & _BV(SPIF)));
+      writeEnd();
+      spi_end();
+    }
+    else if (textcolor == textbgcolor || textsize != 1) {
+
+      if (first) return width * textsize; // drawn whole with the first band
       for (int i = 0; i < height; i++)
       {
         if (textcolor != textbgcolor) fillRect(x, pY, width * textsize, textsize, textbgcolor);
@@ -1771,10 +1884,11 @@ int TFT_ST7735::drawChar(unsigned int uniCode, int x, int y, int font)
       // Faster drawing of characters and background using block write
     {
       spi_begin();
-      setWindow(x, y, (x + w * 8) - 1, y + height - 1);
+      setWindow(x, y + first, (x + w * 8) - 1, y + end - 1);
+      SPI_STAT(0, w * 8 * (end - first) * 2);
 
       byte mask;
-      for (int i = 0; i < height; i++)
+      for (int i = first; i < end; i++)
       {
         for (int k = 0; k < w; k++)
         {
@@ -1813,17 +1927,47 @@ int TFT_ST7735::drawChar(unsigned int uniCode, int x, int y, int font)
 #ifdef LOAD_RLE  //674 bytes of code
   // Font is not 2 and hence is RLE encoded
   {
+    // Without background the runs are drawn as they come, the glyph is drawn whole with the first band
+    if (first && (textcolor == textbgcolor || (textsize != 1 && width > TFT_ROW_BYTES * 8))) return width * textsize;
     spi_begin();
     SPDR = 0; // Dummy write to ensure SPIF flag gets set for first check in while() loop
     w *= height; // Now w is total number of pixels in the character
-    if ((textsize != 1) || (textcolor == textbgcolor)) {
+    if ((textsize != 1) && (textcolor != textbgcolor) && (width <= TFT_ROW_BYTES * 8)) {
+      // Decode one character row at a time and send it textsize times in one block write
+      byte rowbits[TFT_ROW_BYTES];
+      byte run = 0; // Pixels left in the current run
+      boolean on = false;
+      while (!(SPSR & _BV(SPIF)));
+      setWindow(x, y + first * textsize, x + width * textsize - 1, y + end * textsize - 1);
+
+      // The rows before the band are only decoded, the runs go on across rows
+      for (int i = 0; i < end; i++)
+      {
+        memset(rowbits, 0, TFT_ROW_BYTES);
+        for (int k = 0; k < width; k++)
+        {
+          if (!run) {
+            line = pgm_read_byte(flash_address++);
+            on = line & 0x80;
+            run = (line & 0x7F) + 1;
+          }
+          if (on) rowbits[k >> 3] |= 0x80 >> (k & 7);
+          run--;
+        }
+        if (i >= first) pushScaledRow(rowbits, width);
+      }
+      while (!(SPSR & _BV(SPIF)));
+      writeEnd();
+      spi_end();
+    }
+    else if ((textsize != 1) || (textcolor == textbgcolor)) {
       if (textcolor != textbgcolor) fillRect(x, pY, width * textsize, textsize * height, textbgcolor);
-      int px = 0, py = pY, tpy = pY; // To hold character block start and end column and row values
+      int col = 0, py = pY; // To hold run start column and row values
       int pc = 0; // Pixel count
       byte np = textsize * textsize; // Number of pixels in a drawn pixel
-
-      byte tnp = 0; // Temporary copy of np for while loop
       byte ts = textsize - 1; // Temporary copy of textsize
+      byte seg; // Pixels of a run that fit in the current row
+
       // 16 bit pixel count so maximum font size is equivalent to 180x180 pixels in area
       // w is total number of pixels to plot to fill character block
       while (pc < w)
@@ -1833,41 +1977,19 @@ int TFT_ST7735::drawChar(unsigned int uniCode, int x, int y, int font)
         if (line & 0x80) {
           line &= 0x7F;
           line++;
-          if (ts) {
-            px = x + textsize * (pc % width); // Keep these px and py calculations outside the loop as they are slow
-            py = y + textsize * (pc / width);
-          }
-          else {
-            px = x + pc % width; // Keep these px and py calculations outside the loop as they are slow
-            py = y + pc / width;
-          }
-          while (line--) { // In this case the while(line--) is faster
-            pc++; // This is faster than putting pc+=line before while() as we use up SPI wait time
+          col = pc % width; // Keep these col and py calculations outside the loop as they are slow
+          py = y + textsize * (pc / width);
+          pc += line;
+          // One window and one burst for each row the run covers, not for every pixel
+          while (line) {
+            seg = width - col;
+            if (seg > line) seg = line;
             while (!(SPSR & _BV(SPIF)));
-            setWindow(px, py, px + ts, py + ts);
-
-            if (ts) {
-              tnp = np;
-              while (tnp--) {
-                while (!(SPSR & _BV(SPIF)));
-                SPDR = th;
-                while (!(SPSR & _BV(SPIF)));
-                SPDR = tl;
-              }
-            }
-            else {
-              while (!(SPSR & _BV(SPIF)));
-              SPDR = th;
-              while (!(SPSR & _BV(SPIF)));
-              SPDR = tl;
-            }
-            px += textsize;
-
-            if (px >= (x + width * textsize))
-            {
-              px = x;
-              py += textsize;
-            }
+            setWindow(x + col * textsize, py, x + (col + seg) * textsize - 1, py + ts);
+            spiWrite16(textcolor, seg * np);
+            line -= seg;
+            col = 0;
+            py += textsize;
           }
         }
         else {
@@ -1883,21 +2005,22 @@ int TFT_ST7735::drawChar(unsigned int uniCode, int x, int y, int font)
          // so use faster drawing of characters and background using block write
     {
       spi_begin();
-      setWindow(x, y, x + width - 1, y + height - 1);
+      setWindow(x, y + first, x + width - 1, y + end - 1);
 
       // Maximum font size is equivalent to 180x180 pixels in area
+      // Pixels first * width up to end * width are the band, only those parts of the runs are sent
+      int skip = first * width;
+      w = end * width;
       while (w > 0)
       {
         line = pgm_read_byte(flash_address++); // 8 bytes smaller when incrementing here
-        if (line & 0x80) {
-          line &= 0x7F;
-          line++; w -= line;
-          spiWrite16(textcolor, line);
-        }
-        else {
-          line++; w -= line;
-          spiWrite16(textbgcolor, line);
-        }
+        uint16_t color = (line & 0x80) ? textcolor : textbgcolor;
+        int n = (line & 0x7F) + 1;
+        if (n > w) n = w;
+        w -= n;
+        n -= skip;
+        skip = n < 0 ? -n : 0;
+        if (n > 0) spiWrite16(color, n);
       }
       while (!(SPSR & _BV(SPIF)));
       writeEnd();
@@ -1913,7 +2036,7 @@ int TFT_ST7735::drawChar(unsigned int uniCode, int x, int y, int font)
 ** Function name:           drawString
 ** Description :            draw string with padding if it is defined
 ***************************************************************************************/
-int TFT_ST7735::drawString(char *string, int poX, int poY, int font)
+int16_t TFT_ST7735::drawString(char *string, int poX, int poY, int font)
 {
   int16_t sumX = 0;
   uint8_t padding = 1;
@@ -2029,7 +2152,7 @@ return sumX;
 ** Function name:           drawCentreString
 ** Descriptions:            draw string centred on dX
 ***************************************************************************************/
-int TFT_ST7735::drawCentreString(char *string, int dX, int poY, int font)
+int16_t TFT_ST7735::drawCentreString(char *string, int dX, int poY, int font)
 {
   byte tempdatum = textdatum;
   int sumX = 0;
@@ -2043,7 +2166,7 @@ int TFT_ST7735::drawCentreString(char *string, int dX, int poY, int font)
 ** Function name:           drawRightString
 ** Descriptions:            draw string right justified to dX
 ***************************************************************************************/
-int TFT_ST7735::drawRightString(char *string, int dX, int poY, int font)
+int16_t TFT_ST7735::drawRightString(char *string, int dX, int poY, int font)
 {
   byte tempdatum = textdatum;
   int sumX = 0;
@@ -2057,7 +2180,7 @@ int TFT_ST7735::drawRightString(char *string, int dX, int poY, int font)
 ** Function name:           drawNumber
 ** Description:             draw a long integer
 ***************************************************************************************/
-int TFT_ST7735::drawNumber(long long_num, int poX, int poY, int font)
+int16_t TFT_ST7735::drawNumber(long long_num, int poX, int poY, int font)
 {
   char str[12];
   ltoa(long_num, str, 10);
@@ -2068,7 +2191,7 @@ int TFT_ST7735::drawNumber(long long_num, int poX, int poY, int font)
 ** Function name:           drawRightNumber
 ** Description:             draw a long integer right justified to dX
 ***************************************************************************************/
-int TFT_ST7735::drawRightNumber(long long_num, int dX, int poY, int font)
+int16_t TFT_ST7735::drawRightNumber(long long_num, int dX, int poY, int font)
 {
   byte tempdatum = textdatum;
   int sumX = 0;
@@ -2084,7 +2207,7 @@ int TFT_ST7735::drawRightNumber(long long_num, int dX, int poY, int font)
 ** Function name:           drawCentreNumber
 ** Description:             draw a long integer centred on dX
 ***************************************************************************************/
-int TFT_ST7735::drawCentreNumber(long long_num, int dX, int poY, int font)
+int16_t TFT_ST7735::drawCentreNumber(long long_num, int dX, int poY, int font)
 {
   byte tempdatum = textdatum;
   int sumX = 0;
@@ -2102,7 +2225,7 @@ int TFT_ST7735::drawCentreNumber(long long_num, int dX, int poY, int font)
 ***************************************************************************************/
 // Adapted to assemble and print a string, this permits alignment relative to a datum
 // looks complicated but much more compact and actually faster than using print class
-int TFT_ST7735::drawFloat(float floatNumber, int dp, int poX, int poY, int font)
+int16_t TFT_ST7735::drawFloat(float floatNumber, int dp, int poX, int poY, int font)
 {
   char str[14];               // Array to contain decimal string
   uint8_t ptr = 0;            // Initialise pointer for array
@@ -2165,6 +2288,178 @@ int TFT_ST7735::drawFloat(float floatNumber, int dp, int poX, int poY, int font)
   return drawString(str, poX, poY, font);
 }
 
+/***************************************************************************************
+** Function name:           initNumberSlot
+** Description:             define a fixed format number field right justified to dX
+***************************************************************************************/
+// A slot has "cells" characters including sign and decimal point, "dp" of them are
+// decimals. The current text size is captured and all cells are marked as unknown
+// so the first drawSlotNumber() paints the whole field
+void TFT_ST7735::initNumberSlot(numberslot *slot, int dX, int poY, int font, uint8_t cells, uint8_t dp)
+{
+  if (cells > TFT_SLOT_CELLS) cells = TFT_SLOT_CELLS;
+  slot->x = dX;
+  slot->y = poY;
+  slot->fg = textcolor;
+  slot->bg = textbgcolor;
+  slot->font = font;
+  slot->size = textsize;
+  slot->cells = cells;
+  slot->dp = dp;
+  memset(slot->glyph, 0, TFT_SLOT_CELLS);
+  slot->cell = slot->row = 0;
+  slot->pending = 0;
+}
+
+/***************************************************************************************
+** Function name:           drawSlotNumber
+** Description:             draw a scaled long integer into a number slot
+***************************************************************************************/
+// The number carries slot->dp decimals, e.g. 1234 with dp = 2 is shown as 12.34
+// Only cells with a glyph that differs from the last call are sent to the TFT, so a
+// change in the last digit costs one character instead of the whole padded string.
+// Digits and sign use the width of '0', the decimal point uses its own width. Narrow
+// glyphs are drawn at the left of their cell and the rest of the cell is cleared,
+// so a background colour must be set. Returns the pixel width of the slot
+int16_t TFT_ST7735::drawSlotNumber(numberslot *slot, long scaled_num)
+{
+  while (!paintSlotNumber(slot, scaled_num, 0xFFFF));
+
+  char *widthtable = (char *)pgm_read_word( &(fontdata[slot->font].widthtbl ) ) - 32;
+  int16_t digitW = pgm_read_byte(widthtable + '0') * slot->size;
+  int16_t dotW   = slot->dp ? pgm_read_byte(widthtable + '.') * slot->size : 0;
+  return digitW * (slot->cells - (slot->dp ? 1 : 0)) + dotW;
+}
+
+/***************************************************************************************
+** Function name:           paintSlotNumber
+** Description:             paint part of a scaled long integer into a number slot
+***************************************************************************************/
+// Like drawSlotNumber(), but sends about "pixels" pixels at most, in bands of glyph
+// rows, and goes on where it stopped at the next call. At least one glyph row is sent
+// per call. A cell keeps its old glyph until it is painted to the last row, so a
+// number that changes in between only restarts the cell it changed in.
+// Returns true when the slot shows scaled_num
+boolean TFT_ST7735::paintSlotNumber(numberslot *slot, long scaled_num, uint16_t pixels)
+{
+  char str[TFT_SLOT_CELLS];
+  int8_t i = slot->cells - 1;
+  boolean neg = (scaled_num < 0);
+  unsigned long num = neg ? 0UL - (unsigned long)scaled_num : scaled_num;
+
+  // Fill the cells from the right, decimals and point first
+  for (uint8_t d = 0; (d < slot->dp) && (i >= 0); d++) {
+    str[i--] = '0' + num % 10;
+    num /= 10;
+  }
+  if (slot->dp && (i >= 0)) str[i--] = '.';
+
+  // Integer part has at least one digit
+  while (i >= 0) {
+    str[i--] = '0' + num % 10;
+    num /= 10;
+    if (num == 0) break;
+  }
+  if (neg && (i >= 0)) {
+    str[i--] = '-';
+    neg = false;
+  }
+  while (i >= 0) str[i--] = ' ';
+
+  // For error fill with . (all TFT_ST7735 library fonts contain . character)
+  if (num || neg) memset(str, '.', slot->cells);
+
+  // A colour change means every cell has to be repainted
+  if ((slot->fg != textcolor) || (slot->bg != textbgcolor)) {
+    memset(slot->glyph, 0, TFT_SLOT_CELLS);
+    slot->fg = textcolor;
+    slot->bg = textbgcolor;
+    slot->row = 0;
+  }
+
+  byte tempsize = textsize;
+  textsize = slot->size;
+
+  char *widthtable = (char *)pgm_read_word( &(fontdata[slot->font].widthtbl ) ) - 32;
+  int16_t digitW = pgm_read_byte(widthtable + '0') * textsize;
+  int16_t dotW   = slot->dp ? pgm_read_byte(widthtable + '.') * textsize : 0;
+  uint8_t rows   = pgm_read_byte( &fontdata[slot->font].height );
+  int16_t sumX = digitW * (slot->cells - (slot->dp ? 1 : 0)) + dotW;
+  int16_t cX = slot->x - sumX;
+  int16_t cW, gW;
+  boolean sent = false;
+
+  for (i = 0; i < slot->cells; i++) {
+    cW = (slot->dp && (i == slot->cells - 1 - slot->dp)) ? dotW : digitW;
+    if (str[i] != slot->glyph[i]) {
+      if ((slot->cell != i) || (slot->pending != str[i])) {
+        slot->cell = i;
+        slot->pending = str[i];
+        slot->row = 0;
+      }
+      // Glyph rows of this cell that fit the pixels left, at least one per call
+      uint16_t rowPixels = cW * textsize;
+      uint16_t fit = pixels / rowPixels;
+      if (!fit) {
+        if (sent) break;
+        fit = 1;
+      }
+      uint8_t first = slot->row;
+      uint8_t end = (fit < rows - first) ? first + fit : rows;
+
+      gW = 0;
+      if (str[i] != ' ') gW = drawCharRows(str[i], cX, slot->y, slot->font, first, end);
+      if ((gW < cW) && (textcolor != textbgcolor))
+        fillRect(cX + gW, slot->y + first * textsize, cW - gW, (end - first) * textsize, textbgcolor);
+      uint16_t cost = (end - first) * rowPixels;
+      pixels = (cost < pixels) ? pixels - cost : 0;
+      sent = true;
+      slot->row = end;
+      if (end < rows) break;
+
+      // Font 2 is plotted in whole bytes, a narrow glyph can overwrite the next cell
+      if ((slot->font == 2) && (textsize == 1) && (((gW + 6) & 0xF8) > cW) && (i + 1 < slot->cells))
+        slot->glyph[i + 1] = 0;
+      slot->glyph[i] = str[i];
+      slot->row = 0;
+    }
+    cX += cW;
+  }
+
+  textsize = tempsize;
+  return i >= slot->cells;
+}
+
+#ifdef SPI_STATS
+/***************************************************************************************
+** Function name:           spiCommands
+** Description:             Return the number of TFT commands sent since the last reset
+***************************************************************************************/
+uint32_t TFT_ST7735::spiCommands(void)
+{
+  return statCommands;
+}
+
+/***************************************************************************************
+** Function name:           spiBytes
+** Description:             Return the number of TFT data bytes sent since the last reset
+***************************************************************************************/
+uint32_t TFT_ST7735::spiBytes(void)
+{
+  return statBytes;
+}
+
+/***************************************************************************************
+** Function name:           resetSpiStats
+** Description:             Clear the SPI command and data byte counters
+***************************************************************************************/
+void TFT_ST7735::resetSpiStats(void)
+{
+  statCommands = 0;
+  statBytes = 0;
+}
+#endif // SPI_STATS
+
 /***************************************************************************************
 ** Function name:           spiWrite16
 ** Descriptions:            Delay based assembler loop for fast SPI write
@@ -2174,6 +2469,8 @@ inline void spiWrite16(uint16_t data, int16_t count)
 // We can enter this loop with 0 pixels to draw, so we need to check this
 // if(count<1) { Serial.print("#### Less than 1 ####"); Serial.println(count);}
 
+  SPI_STAT(0, count * 2);
+#ifdef __AVR__
   uint8_t temp;
   asm volatile
   (
@@ -2206,6 +2503,14 @@ inline void spiWrite16(uint16_t data, int16_t count)
     : [spi] "i" (_SFR_IO_ADDR(SPDR)), [lo] "r" ((uint8_t)data), [hi] "r" ((uint8_t)(data>>8))
     :
   );
+#else
+  while (count-- > 0) {
+    SPDR = data >> 8;
+    while (!(SPSR & _BV(SPIF)));
+    SPDR = data;
+    while (!(SPSR & _BV(SPIF)));
+  }
+#endif
 }
 
 /***************************************************************************************
@@ -2214,6 +2519,8 @@ inline void spiWrite16(uint16_t data, int16_t count)
 ***************************************************************************************/
 inline void spiWrite16s(uint16_t data)
 {
+  SPI_STAT(0, 2);
+#ifdef __AVR__
   uint8_t temp;
   asm volatile
   (
@@ -2235,6 +2542,11 @@ inline void spiWrite16s(uint16_t data)
     : [spi] "i" (_SFR_IO_ADDR(SPDR)), [lo] "r" ((uint8_t)data), [hi] "r" ((uint8_t)(data>>8))
     :
   );
+#else
+  SPDR = data >> 8;
+  while (!(SPSR & _BV(SPIF)));
+  SPDR = data;
+#endif
 }
 
 
@@ -2247,6 +2559,7 @@ inline void spiWrite16R(uint16_t data, int16_t count)
 // We can enter this loop with 0 pixels to draw, so we need to check this
 // if(count<1) { Serial.print("#### Less than 1 ####"); Serial.println(count);}
 
+#ifdef __AVR__
   uint8_t temp;
   asm volatile
   (
@@ -2280,6 +2593,14 @@ inline void spiWrite16R(uint16_t data, int16_t count)
     : [spi] "i" (_SFR_IO_ADDR(SPDR)), [lo] "r" ((uint8_t)(data>>8)), [hi] "r" ((uint8_t)data)
     :
   );
+#else
+  while (count-- > 0) {
+    SPDR = data;
+    while (!(SPSR & _BV(SPIF)));
+    SPDR = data >> 8;
+    while (!(SPSR & _BV(SPIF)));
+  }
+#endif
 }
 
 /***************************************************************************************
@@ -2288,6 +2609,7 @@ inline void spiWrite16R(uint16_t data, int16_t count)
 ***************************************************************************************/
 inline void spiWait17(void)
 {
+#ifdef __AVR__
   asm volatile
   (
     "	rcall	1f    \n" // 7
@@ -2296,6 +2618,9 @@ inline void spiWait17(void)
     "1:	ret   \n" // 
     "2:	nop	 \n" // 17
   );
+#else
+  while (!(SPSR & _BV(SPIF)));
+#endif
 }
 
 /***************************************************************************************
@@ -2304,6 +2629,7 @@ inline void spiWait17(void)
 ***************************************************************************************/
 inline void spiWait15(void)
 {
+#ifdef __AVR__
   asm volatile
   (
     "	adiw	r24,0  \n"	// 2
@@ -2314,6 +2640,9 @@ inline void spiWait15(void)
     "1:	ret    \n"	//
     "2:	       \n"	//
   );
+#else
+  while (!(SPSR & _BV(SPIF)));
+#endif
 }
 
 /***************************************************************************************
@@ -2322,6 +2651,7 @@ inline void spiWait15(void)
 ***************************************************************************************/
 inline void spiWait14(void)
 {
+#ifdef __AVR__
   asm volatile
   (
     "	nop         \n"	// 1
@@ -2332,6 +2662,9 @@ inline void spiWait14(void)
     "1:	ret    \n"	//
     "2:	       \n"	//
   );
+#else
+  while (!(SPSR & _BV(SPIF)));
+#endif
 }
 
 /***************************************************************************************
@@ -2340,6 +2673,7 @@ inline void spiWait14(void)
 ***************************************************************************************/
 inline void spiWait12(void)
 {
+#ifdef __AVR__
   asm volatile
   (
     "	nop         \n"	// 1
@@ -2349,6 +2683,9 @@ inline void spiWait12(void)
     "1:	ret    \n"	//
     "2:	       \n"	//
   );
+#else
+  while (!(SPSR & _BV(SPIF)));
+#endif
 }
 
 /***************************************************
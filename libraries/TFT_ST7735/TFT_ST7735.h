@@ -213,6 +213,20 @@ typedef struct {
 	unsigned       char height;
 	} fontinfo;
 
+// Maximum number of character cells in a number slot, every slot holds this many bytes of glyphs
+#define TFT_SLOT_CELLS 6
+
+// This is a structure to hold a fixed format number field on the screen
+// Stores the glyph drawn in each cell so only changed cells get redrawn
+typedef struct {
+	int16_t  x, y;      // Right edge and top of the slot
+	uint16_t fg, bg;    // Colours the cells were last drawn with
+	uint8_t  font, size, cells, dp;
+	char     glyph[TFT_SLOT_CELLS];
+	uint8_t  cell, row; // Cell and glyph row a paintSlotNumber() stopped at
+	char     pending;   // and the glyph it was painting there
+	} numberslot;
+
 // This is a structure to conveniently hold infomation on the fonts
 // Stores font character image address pointer, width table and height
 
@@ -318,6 +332,8 @@ class TFT_ST7735 : public Print {
            setTextDatum(uint8_t datum),
            setTextPadding(uint16_t x_width),
 
+           initNumberSlot(numberslot *slot, int dX, int poY, int font, uint8_t cells, uint8_t dp),
+
            spiwrite(uint8_t),
            writecommand(uint8_t c),
            writedata(uint8_t d),
@@ -325,6 +341,15 @@ class TFT_ST7735 : public Print {
 
   uint8_t  getRotation(void);
 
+#ifdef SPI_STATS
+  uint32_t spiCommands(void),
+           spiBytes(void);
+
+  void     resetSpiStats(void);
+#endif
+
+  boolean  paintSlotNumber(numberslot *slot, long scaled_num, uint16_t pixels);
+
   uint16_t fontsLoaded(void),
            color565(uint8_t r, uint8_t g, uint8_t b);
 
@@ -333,6 +358,8 @@ class TFT_ST7735 : public Print {
 		   drawRightNumber(long long_num, int dX, int poY, int font),
 		   drawCentreNumber(long long_num, int dX, int poY, int font),
            drawFloat(float floatNumber,int decimal,int poX, int poY, int font),
+           drawSlotNumber(numberslot *slot, long scaled_num),
+           drawCharRows(unsigned int uniCode, int x, int y, int font, uint8_t first, uint8_t end),
 
            drawString(char *string, int poX, int poY, int font),
            drawCentreString(char *string, int dX, int poY, int font),
@@ -348,16 +375,21 @@ class TFT_ST7735 : public Print {
  private:
 
     void   setWindow(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+    void   pushScaledRow(uint8_t *rowbits, uint8_t width);
 
   uint8_t  tabcolor,
            colstart, rowstart; // some displays need this changed
 
   boolean  hwSPI;
 
-  uint8_t  mySPCR, savedSPCR;
+  uint8_t  mySPCR, savedSPCR,
+           mySPSR, savedSPSR; // Only the SPI2X clock doubler bit
 
   int8_t   _cs, _dc, _rst, _mosi, _miso, _sclk;
 
+  const unsigned char *rle_chrtbl, *rle_widtbl; // Descriptor of the last RLE font drawn
+  uint8_t  rle_font, rle_height;
+
 
  protected:
 
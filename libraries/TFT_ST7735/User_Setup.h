@@ -88,3 +88,10 @@
 
 // #define SUPPORT_TRANSACTIONS
 
+// Uncomment the following #define to count the commands and data bytes sent to the
+// TFT. Read them with spiCommands() and spiBytes() around any drawing call to see
+// what it costs on the SPI bus, resetSpiStats() clears the counters. Leave it
+// commented out for normal use, the counting slows down every pixel write
+
+//#define SPI_STATS
+
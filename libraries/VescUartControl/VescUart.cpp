@@ -56,7 +56,7 @@ int ReceiveUartMessage(uint8_t* payloadReceived) {
 			}
 
 		}
-		if (counter >= sizeof(messageReceived))
+		if (counter >= (int)sizeof(messageReceived))
 		{
 			break;
 		}
@@ -139,7 +139,7 @@ int PackSendPayload(uint8_t* payload, int lenPay) {
 	messageSend[count++] = (uint8_t)(crcPayload >> 8);
 	messageSend[count++] = (uint8_t)(crcPayload & 0xFF);
 	messageSend[count++] = 3;
-	messageSend[count] = NULL;
+	messageSend[count] = 0;
 
 #ifdef DEBUGSERIAL
 	DEBUGSERIAL.print("UART package send: "); SerialPrint(messageSend, count);
@@ -174,13 +174,13 @@ bool ProcessReadPacket(uint8_t* message, bldcMeasure& values, int len) {
 		//values.temp_mos6 = buffer_get_float16(data, 10.0, &ind);
 		//values.temp_pcb = buffer_get_float16(data, 10.0, &ind);
 		ind = 14; //Skip
-		values.current_motor = buffer_get_float32(message, 100.0, &ind);
-		values.current_in  = buffer_get_float32(message, 100.0, &ind);
-		values.duty_now  = buffer_get_float16(message, 1000.0, &ind);
+		values.current_motor = buffer_get_fixed32<100>(message, &ind);
+		values.current_in  = buffer_get_fixed32<100>(message, &ind);
+		values.duty_now  = buffer_get_fixed16<1000>(message, &ind);
 		values.rpm = buffer_get_int32(message, &ind);
-		values.v_in  = buffer_get_float16(message, 10.0, &ind);
-		values.amp_hours = buffer_get_float32(message, 10000.0, &ind);
-		values.amp_hours_charged = buffer_get_float32(message, 10000.0, &ind);
+		values.v_in  = buffer_get_fixed16<10>(message, &ind);
+		values.amp_hours = buffer_get_fixed32<10000>(message, &ind);
+		values.amp_hours_charged = buffer_get_fixed32<10000>(message, &ind);
 		//values.watt_hours = buffer_get_float32(data, 10000.0, &ind);
 		//values.watt_hours_charged = buffer_get_float32(data, 10000.0, &ind);
 		//values.tachometer = buffer_get_int32(message, &ind);
@@ -201,7 +201,9 @@ bool VescUartRequestValues() {
 		uint8_t command[1] = { COMM_GET_VALUES };
 		PackSendPayload(command, 1);
 		timeLastRequest = millis();
+		return true;
 	}
+	return false;
 }
 
 bool VescUartGetValue(bldcMeasure& values) {
@@ -230,21 +232,38 @@ void VescUartSetDuty(float dutyCycle) {
 	PackSendPayload(payload, 5);
 }
 
+void VescUartSetRPM(int32_t rpm) {
+	int32_t index = 0;
+	uint8_t payload[5];
+
+	payload[index++] = COMM_SET_RPM;
+	buffer_append_int32(payload, rpm, &index);
+	PackSendPayload(payload, 5);
+}
+
 void VescUartSetCurrent(float current) {
+	VescUartSetCurrentMilli((int32_t)(current * 1000));
+}
+
+void VescUartSetCurrentBrake(float brakeCurrent) {
+	VescUartSetCurrentBrakeMilli((int32_t)(brakeCurrent * 1000));
+}
+
+void VescUartSetCurrentMilli(int32_t current) {
 	int32_t index = 0;
 	uint8_t payload[5];
 		
 	payload[index++] = COMM_SET_CURRENT ;
-	buffer_append_int32(payload, (int32_t)(current * 1000), &index);
+	buffer_append_int32(payload, current, &index);
 	PackSendPayload(payload, 5);
 }
 
-void VescUartSetCurrentBrake(float brakeCurrent) {
+void VescUartSetCurrentBrakeMilli(int32_t brakeCurrent) {
 	int32_t index = 0;
 	uint8_t payload[5];
 
 	payload[index++] = COMM_SET_CURRENT_BRAKE;
-	buffer_append_int32(payload, (int32_t)(brakeCurrent * 1000), &index);
+	buffer_append_int32(payload, brakeCurrent, &index);
 	PackSendPayload(payload, 5);
 
 }
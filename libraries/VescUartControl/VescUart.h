@@ -22,7 +22,7 @@ along with this program.If not, see <http://www.gnu.org/licenses/>.
 
 #define SERIALIO Serial
 //#define DEBUGSERIAL Serial1
-#include "arduino.h"
+#include "Arduino.h"
 
  
 #include "datatypes.h"
@@ -49,6 +49,10 @@ void SerialPrint(const struct bldcMeasure& values);
 ///Define in a Config.h the DEBUGSERIAL you want to use
 void SerialPrint(uint8_t* data, int len);
 
+///Requests the values from the VESC, at most every 100ms and only if nothing is left to read
+///@return true if a request was send
+bool VescUartRequestValues();
+
 ///Sends a command to VESC and stores the returned data
 ///@param bldcMeasure struct with received data
 //@return true if sucess
@@ -67,6 +71,18 @@ void VescUartSetCurrent(float current);
 ///@param breakCurrent as float with the current for the brake
 void VescUartSetCurrentBrake(float brakeCurrent);
 
+///Sends a command to VESC to hold a speed used for cruiseCTRL
+///@param rpm as int32_t with the electrical rpm (as bldcMeasure.rpm) to hold
+void VescUartSetRPM(int32_t rpm);
+
+///Sends a command to VESC to control the motor current, without float math
+///@param current as int32_t with the current for the motor in mA
+void VescUartSetCurrentMilli(int32_t current);
+
+///Sends a command to VESC to control the motor brake, without float math
+///@param breakCurrent as int32_t with the current for the brake in mA
+void VescUartSetCurrentBrakeMilli(int32_t brakeCurrent);
+
 /// CRC Check
 bool UnpackPayload(uint8_t* message, int lenMes, uint8_t* payload, int lenPa);
 
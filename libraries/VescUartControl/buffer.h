@@ -41,4 +41,40 @@ float buffer_get_float16(const uint8_t *buffer, float scale, int32_t *index);
 float buffer_get_float32(const uint8_t *buffer, float scale, int32_t *index);
 bool buffer_get_bool(const uint8_t *buffer, int32_t *index);
 void buffer_append_bool(uint8_t *buffer,bool value, int32_t *index);
+
+/*
+ * Fixed point codec, the scales are template parameters.
+ *
+ * A field sent with scale From (e.g. 100 for 0.01A) is returned as an
+ * integer with scale To (e.g. 1000 for mA). Both scales are known at compile
+ * time, so the conversion is nothing, one multiply or one divide by a
+ * constant, instead of a float divide. Scaling down truncates towards zero.
+ * buffer_to_float() gives the same result as buffer_get_float16/32 for the
+ * places that really want a float.
+ */
+template <int32_t From, int32_t To>
+inline int32_t buffer_rescale(int32_t value) {
+	static_assert(From % To == 0 || To % From == 0, "scales have to be multiples of each other");
+	if (To > From)
+		return value * (To / From);
+	if (To < From)
+		return value / (From / To);
+	return value;
+}
+
+template <int32_t From, int32_t To = From>
+inline int32_t buffer_get_fixed16(const uint8_t *buffer, int32_t *index) {
+	return buffer_rescale<From, To>(buffer_get_int16(buffer, index));
+}
+
+template <int32_t From, int32_t To = From>
+inline int32_t buffer_get_fixed32(const uint8_t *buffer, int32_t *index) {
+	return buffer_rescale<From, To>(buffer_get_int32(buffer, index));
+}
+
+template <int32_t Scale>
+inline float buffer_to_float(int32_t value) {
+	return (float)value / (float)Scale;
+}
+
 #endif /* BUFFER_H_ */
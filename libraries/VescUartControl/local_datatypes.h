@@ -2,6 +2,7 @@
 #define LOCAL_DATATYPES_H_
 
 // Added by AC to store measured values
+// Kept in the fixed point units of COMM_GET_VALUES, float only where a value is shown
 struct bldcMeasure {
 	//7 Values int16_t not read(14 byte)
 	//float temp_mos1
@@ -11,18 +12,19 @@ struct bldcMeasure {
 	//float temp_mos5
 	//float temp_mos6
 	//float temp_pcb
-	float current_motor;
-	float current_in;
-	float duty_now;
-	long rpm;
-	float v_in;
-	float amp_hours;
-	float amp_hours_charged;
+	int32_t current_motor;     // [0.01A]
+	int32_t current_in;        // [0.01A]
+	int16_t duty_now;          // [0.1%]
+	int32_t rpm;               // [erpm]
+	int16_t v_in;              // [0.1V]
+	int32_t amp_hours;         // [0.1mAh]
+	int32_t amp_hours_charged; // [0.1mAh]
 	//3 values not read (12 byte)
 	//float watt_hours;
 	//float watt_hours_charged;
 	//long tachometer;
-	long tachometerAbs;
+	int32_t tachometerAbs;
+	uint16_t led_power;        // [mW] of the RX light strips, not from the VESC
 };
 
 //Define remote Package
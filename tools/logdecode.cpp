@@ -0,0 +1,222 @@
+/*
+  logdecode - converts EMTB ride logs (LOGnnn.BIN) to CSV or column files
+
+  Build:  g++ -O2 -o logdecode logdecode.cpp
+  Usage:  logdecode [-e] [-c dir] LOGnnn.BIN...
+
+  Without -c all samples, from key and delta frames, are written as CSV to
+  stdout: ms, seq of the frame, one column per entry of the field table in
+  the log header, and speed_kmh and dist_km computed with the ratios from
+  the header. With more than one log
+  a leading file column holds the index of the log on the command line.
+
+  -e adds the samples of the event dumps and a leading events column with
+  the LOG_EVT_ bits of the dump, 0 for the regular samples. The dumped
+  samples are older than the event, so ms is not monotonic any more.
+
+  -c dir writes one binary column per value instead: ms.u32 and seq.u16 as
+  little endian integers, all other columns as little endian float32.
+
+  A summary of every log (samples, frames, lost, bad and unresolved frames,
+  skipped bytes) goes to stderr.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "logreader.h"
+
+#define OUT_BUFFER (1 << 20)
+
+static char *putInt(char *p, long long v)
+{
+    char tmp[24];
+    int n = 0;
+    unsigned long long u = v < 0 ? -(unsigned long long)v : v;
+
+    if (v < 0) *p++ = '-';
+    do {
+        tmp[n++] = '0' + u % 10;
+        u /= 10;
+    } while (u);
+    while (n) *p++ = tmp[--n];
+    return p;
+}
+
+// Fixed point with up to 5 decimals, trailing zeros removed
+static char *putFixed(char *p, double v)
+{
+    long long x;
+    int decimals = 5;
+
+    if (isnan(v) || isinf(v)) return p + sprintf(p, "%g", v);
+    if (fabs(v) > 9e12) return p + sprintf(p, "%.6e", v);
+    x = llround(v * 100000);
+    if (x < 0) {
+        *p++ = '-';
+        x = -x;
+    }
+    p = putInt(p, x / 100000);
+    x %= 100000;
+    while (decimals && x % 10 == 0) {
+        x /= 10;
+        decimals--;
+    }
+    if (decimals) {
+        *p++ = '.';
+        for (int i = decimals - 1; i >= 0; i--) {
+            p[i] = '0' + x % 10;
+            x /= 10;
+        }
+        p += decimals;
+    }
+    return p;
+}
+
+static FILE *openColumn(const char *dir, const char *name, const char *ext)
+{
+    char path[512];
+    FILE *f;
+
+    snprintf(path, sizeof(path), "%s/%s.%s", dir, name, ext);
+    f = fopen(path, "wb");
+    if (!f) {
+        perror(path);
+        exit(1);
+    }
+    setvbuf(f, NULL, _IOFBF, 1 << 16);
+    return f;
+}
+
+int main(int argc, char *argv[])
+{
+    static logReader r;
+    static logField table[LOG_MAX_FIELDS];
+    static FILE *columns[LOG_MAX_FIELDS + 5];
+    static char out[OUT_BUFFER + 4096];
+    const char *dir = NULL;
+    uint8_t tableFields = 0;
+    bool ticks = false;
+    int first = 1, result = 0;
+
+    for (; first < argc && argv[first][0] == '-'; first++) {
+        if (!strcmp(argv[first], "-e")) {
+            ticks = true;
+        } else if (!strcmp(argv[first], "-c") && first + 1 < argc) {
+            dir = argv[++first];
+        } else {
+            first = argc;
+        }
+    }
+    if (first >= argc) {
+        fprintf(stderr, "Usage: logdecode [-e] [-c dir] LOGnnn.BIN...\n");
+        return 1;
+    }
+
+    for (int a = first; a < argc; a++) {
+        const char *err = logOpen(&r, argv[a]);
+        if (err) {
+            fprintf(stderr, "%s: %s\n", argv[a], err);
+            logClose(&r);
+            result = 1;
+            continue;
+        }
+        r.ticks = ticks;
+
+        // All logs go into the same columns, so they need the same field table
+        if (a == first) {
+            tableFields = r.header.fields;
+            memcpy(table, r.fields, sizeof(table));
+            if (dir) {
+                columns[0] = openColumn(dir, "ms", "u32");
+                columns[1] = openColumn(dir, "seq", "u16");
+                columns[2] = openColumn(dir, "speed_kmh", "f32");
+                columns[3] = openColumn(dir, "dist_km", "f32");
+                if (ticks) columns[LOG_MAX_FIELDS + 4] = openColumn(dir, "events", "u8");
+                for (uint8_t i = 0; i < tableFields; i++)
+                    columns[4 + i] = openColumn(dir, table[i].name, "f32");
+            } else {
+                char *p = out;
+                if (argc - first > 1) p += sprintf(p, "file,");
+                if (ticks) p += sprintf(p, "events,");
+                p += sprintf(p, "ms,seq");
+                for (uint8_t i = 0; i < tableFields; i++)
+                    p += sprintf(p, ",%s", table[i].name);
+                p += sprintf(p, ",speed_kmh,dist_km\n");
+                fwrite(out, 1, p - out, stdout);
+            }
+        } else if (r.header.fields != tableFields || memcmp(r.fields, table, tableFields * sizeof(logField))) {
+            fprintf(stderr, "%s: field table differs from %s, skipped\n", argv[a], argv[first]);
+            logClose(&r);
+            result = 1;
+            continue;
+        }
+
+        int rpm = logFieldIndex(&r, "rpm");
+        int tacho = logFieldIndex(&r, "tachometerAbs");
+        const uint8_t *payload;
+        char *p = out;
+
+        while ((payload = logNextSample(&r))) {
+            double speed = rpm < 0 ? NAN : logValue(&r.fields[rpm], payload) * r.header.ratio_RpmSpeed;
+            double dist = tacho < 0 ? NAN : logValue(&r.fields[tacho], payload) * r.header.ratio_TachoDist;
+
+            if (dir) {
+                uint32_t ms = r.ms;
+                uint16_t seq = r.lastSeq;
+                float v;
+                fwrite(&ms, 4, 1, columns[0]);
+                fwrite(&seq, 2, 1, columns[1]);
+                if (ticks) {
+                    uint8_t events = r.isTick ? r.events : 0;
+                    fwrite(&events, 1, 1, columns[LOG_MAX_FIELDS + 4]);
+                }
+                v = speed;
+                fwrite(&v, 4, 1, columns[2]);
+                v = dist;
+                fwrite(&v, 4, 1, columns[3]);
+                for (uint8_t i = 0; i < tableFields; i++) {
+                    v = logValue(&r.fields[i], payload);
+                    fwrite(&v, 4, 1, columns[4 + i]);
+                }
+                continue;
+            }
+
+            if (argc - first > 1) {
+                p = putInt(p, a - first);
+                *p++ = ',';
+            }
+            if (ticks) {
+                p = putInt(p, r.isTick ? r.events : 0);
+                *p++ = ',';
+            }
+            p = putInt(p, r.ms);
+            *p++ = ',';
+            p = putInt(p, r.lastSeq);
+            for (uint8_t i = 0; i < tableFields; i++) {
+                *p++ = ',';
+                p = putFixed(p, logValue(&r.fields[i], payload));
+            }
+            *p++ = ',';
+            p = putFixed(p, speed);
+            *p++ = ',';
+            p = putFixed(p, dist);
+            *p++ = '\n';
+            if (p - out > OUT_BUFFER) {
+                fwrite(out, 1, p - out, stdout);
+                p = out;
+            }
+        }
+        fwrite(out, 1, p - out, stdout);
+
+        fprintf(stderr, "%s: %llu samples, %llu events, %llu frames, %llu lost, %llu bad, %llu unresolved, %llu bytes skipped\n",
+                argv[a], (unsigned long long)r.samples, (unsigned long long)r.eventFrames, (unsigned long long)r.frames,
+                (unsigned long long)r.lostFrames, (unsigned long long)r.badFrames,
+                (unsigned long long)r.unresolved, (unsigned long long)r.skipped);
+        logClose(&r);
+    }
+
+    for (int i = 0; i < LOG_MAX_FIELDS + 5; i++)
+        if (columns[i]) fclose(columns[i]);
+    return result;
+}
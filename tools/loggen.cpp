@@ -0,0 +1,332 @@
+/*
+  loggen - writes synthetic EMTB ride logs for tests and benchmarks
+
+  Build:  g++ -O2 -I../libraries/VescUartControl -o loggen loggen.cpp
+  Usage:  loggen [-m MB] [-r seed] [-t] OUT.BIN
+
+  Writes a log like the TX does: the header with the constants and the
+  field table of EMTB_TX.cpp, a key frame every 40 samples and the samples
+  in between delta encoded in frames of up to 100 bytes (SDLog), one sample
+  every 100 ms (SDrefresh). The ride follows a throttle profile with climbs,
+  cruising and braking, the battery sags under load and the counters of
+  the VESC run on. Every brake and every few minutes a link loss add an
+  event frame with the tick dump of the TX: a sample every 20 ms before
+  the event as one LOG_REC_TICK and one LOG_REC_TICKS frame, as many as
+  fit the 255 bytes ring of the TX. The log grows until it has -m
+  MB (default 10), the rest of the last sector is zero filled.
+
+  -t tears the log like a power cut: the last frame is cut short and one
+  frame in the middle gets a flipped byte, so the readers have to skip a
+  bad frame and resync.
+
+  Prints samples, frames and bytes on stderr.
+*/
+
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "../libraries/SDLog/LogFormat.h"
+#include "local_datatypes.h"
+
+// Constants of EMTB_TX.cpp
+static const uint8_t wheelsize = 200;
+static const uint8_t gearratio = 3;
+static const uint8_t pulse_rpm = 42;
+static const uint8_t erpm_rpm = 7;
+static const float dist_corr_factor = 0.8;
+static const float ratio_RpmSpeed = (wheelsize * 3.141 * 60) / (erpm_rpm * gearratio * 1000000);
+static const float ratio_TachoDist = ((wheelsize * 3.141) / (pulse_rpm * gearratio * 1000000)) * dist_corr_factor;
+static const uint16_t SDrefresh = 100; // [ms]
+static const uint8_t tickPeriod = 20;  // [ms] between the samples of an event dump
+static const uint8_t tickBytes = 255;  // delta bytes of an event dump
+static const uint8_t tickSpan = 60;    // samples generated for a dump, more than fit
+static const uint8_t keyInterval = 40; // default of SDLog::keyInterval()
+static const uint8_t blockSize = 100;  // SDLOG_BLOCK
+static const unsigned sector = 512;
+
+// logSample of EMTB_TX.cpp
+struct logSample {
+    struct RemoteDataStruct remote;
+    int16_t current_motor;     // [0.01A]
+    int16_t current_in;        // [0.01A]
+    int16_t duty_now;          // [0.1%]
+    int32_t rpm;               // ERPM
+    int16_t v_in;              // [0.1V]
+    int32_t amp_hours;         // [0.1mAh]
+    int32_t amp_hours_charged; // [0.1mAh]
+    int32_t tachometerAbs;
+    uint8_t radio_fails;
+    uint16_t loop_max; // [ms]
+    uint16_t vesc_age; // [ms]
+    uint16_t led_power; // [mW]
+} __attribute__((packed));
+
+static const logField logFields[] = {
+    {"thr", LOG_I8, offsetof(logSample, remote.thr), 1},
+    {"cruise", LOG_BOOL, offsetof(logSample, remote.cruise), 1},
+    {"deadband", LOG_U8, offsetof(logSample, remote._deadband), 1},
+    {"amp_fwd", LOG_U8, offsetof(logSample, remote._amp_fwd), 0.5},
+    {"amp_break", LOG_U8, offsetof(logSample, remote._amp_break), 0.1},
+    {"current_motor", LOG_I16, offsetof(logSample, current_motor), 0.01},
+    {"current_in", LOG_I16, offsetof(logSample, current_in), 0.01},
+    {"duty_now", LOG_I16, offsetof(logSample, duty_now), 0.001},
+    {"rpm", LOG_I32, offsetof(logSample, rpm), 1},
+    {"v_in", LOG_I16, offsetof(logSample, v_in), 0.1},
+    {"amp_hours", LOG_I32, offsetof(logSample, amp_hours), 0.0001},
+    {"amp_hours_charged", LOG_I32, offsetof(logSample, amp_hours_charged), 0.0001},
+    {"tachometerAbs", LOG_I32, offsetof(logSample, tachometerAbs), 1},
+    {"radio_fails", LOG_U8, offsetof(logSample, radio_fails), 1},
+    {"loop_max", LOG_U16, offsetof(logSample, loop_max), 1},
+    {"vesc_age", LOG_U16, offsetof(logSample, vesc_age), 1},
+    {"led_power", LOG_U16, offsetof(logSample, led_power), 1}};
+
+static const uint8_t fieldCount = sizeof(logFields) / sizeof(logField);
+
+struct writer {
+    FILE *f;
+    uint64_t bytes;
+    uint64_t frames;
+    uint16_t seq;
+    uint8_t block[blockSize];
+    uint8_t fill;
+    uint32_t blockMs;
+};
+
+static void put(writer *w, const void *data, size_t len)
+{
+    fwrite(data, 1, len, w->f);
+    w->bytes += len;
+}
+
+static void putFrame(writer *w, uint8_t type, const void *data, uint8_t len, uint32_t ms)
+{
+    logFrame frame;
+    uint16_t crc;
+
+    frame.sync = LOG_SYNC;
+    frame.type = type;
+    frame.len = len;
+    frame.seq = w->seq++;
+    frame.ms = ms;
+    crc = logCrc16(0, &frame.type, sizeof(logFrame) - 1);
+    crc = logCrc16(crc, data, len);
+    put(w, &frame, sizeof(frame));
+    put(w, data, len);
+    put(w, &crc, 2);
+    w->frames++;
+}
+
+static void closeBlock(writer *w)
+{
+    if (w->fill) putFrame(w, LOG_REC_DELTA, w->block, w->fill, w->blockMs);
+    w->fill = 0;
+}
+
+// Small xorshift, the same log for the same seed on every host
+static uint32_t rnd(uint32_t *s)
+{
+    *s ^= *s << 13;
+    *s ^= *s >> 17;
+    *s ^= *s << 5;
+    return *s;
+}
+
+// Rider and VESC at time ms, the state moves on by dt
+struct ride {
+    double speed;   // [km/h]
+    double ah, ahc; // [Ah]
+    double tacho;   // pulses
+    double load;    // [A] hill
+    int8_t thr;
+};
+
+static void step(ride *r, logSample *s, uint32_t ms, uint32_t *seed)
+{
+    const double dt = SDrefresh / 1000.0;
+    uint32_t t = ms / 1000;
+
+    // A minute long cycle: accelerate, cruise, climb, brake to a stop
+    uint32_t phase = t % 60;
+    if (phase < 10) r->thr = 40 + phase * 8;
+    else if (phase < 30) r->thr = 60;
+    else if (phase < 45) r->thr = 100;
+    else if (phase < 50) r->thr = 0;
+    else r->thr = -60;
+    r->load = phase >= 30 && phase < 45 ? 8 : 1;
+
+    // The VESC holds the speed the throttle asks for, up to 40 km/h at full duty 50 km/h
+    double motor = 0;
+    if (r->thr > 5) motor = fmin(fmax(2 * (r->thr * 0.4 - r->speed) + r->load + 0.3 * r->speed, 0), 40);
+    else if (r->thr < -5 && r->speed > 0) motor = r->thr * 0.25;
+    motor += (int32_t)(rnd(seed) % 100 - 50) / 100.0;
+    r->speed = fmax(r->speed + (motor - r->load - 0.3 * r->speed) * 0.5 * dt, 0);
+
+    double rpm = r->speed / ratio_RpmSpeed;
+    double duty = r->speed / 50;
+    double in = motor * duty;
+    double volt = 40 - r->ah * 0.4 - in * 0.15;
+
+    if (in > 0) r->ah += in * dt / 3600;
+    else r->ahc -= in * dt / 3600;
+    r->tacho += rpm / 60 * dt * pulse_rpm / erpm_rpm;
+
+    s->remote.thr = r->thr;
+    s->remote.cruise = phase >= 10 && phase < 30;
+    s->remote._deadband = 10;
+    s->remote._amp_fwd = 80;
+    s->remote._amp_break = 100;
+    s->current_motor = lround(motor * 100);
+    s->current_in = lround(in * 100);
+    s->duty_now = lround(duty * 1000);
+    s->rpm = lround(rpm);
+    s->v_in = lround(volt * 10);
+    s->amp_hours = lround(r->ah * 10000);
+    s->amp_hours_charged = lround(r->ahc * 10000);
+    s->tachometerAbs = lround(r->tacho);
+    s->radio_fails = 0;
+    s->loop_max = 10 + rnd(seed) % 8;
+    s->vesc_age = 10 + rnd(seed) % 20;
+    s->led_power = r->thr < 0 ? 2400 : 1200;
+}
+
+// The event ring of the TX: samples every tickPeriod up to ms, running from prev to sample,
+// the oldest deltas go into the first sample until the rest fits tickBytes
+static void putTicks(writer *w, const logSlot *slots, const logSample *prev, const logSample *sample, uint8_t events,
+                     uint32_t ms)
+{
+    logSample first, last;
+    uint8_t ring[tickSpan * LOG_DELTA_MAX(fieldCount)];
+    uint8_t span = ms / tickPeriod < tickSpan ? ms / tickPeriod : tickSpan;
+    uint32_t firstMs = ms - span * tickPeriod;
+    unsigned fill = 0, start = 0;
+
+    for (uint8_t i = 0; i <= span; i++) {
+        logSample tick = *sample;
+        uint8_t back = span - i;
+        tick.current_motor -= (sample->current_motor - prev->current_motor) * back / 5;
+        tick.current_in -= (sample->current_in - prev->current_in) * back / 5;
+        tick.rpm -= (sample->rpm - prev->rpm) * back / 5;
+        tick.tachometerAbs -= (sample->tachometerAbs - prev->tachometerAbs) * back / 5;
+        tick.loop_max = 1 + i % 3;
+        tick.vesc_age = events & LOG_EVT_LINK ? back * tickPeriod : i % 2 * tickPeriod;
+        if (!i) first = tick;
+        else fill = logEncodeDelta(ring + fill, tickPeriod, slots, fieldCount, (uint8_t *)&last,
+                                   (const uint8_t *)&tick) - ring;
+        last = tick;
+    }
+    while (fill - start > tickBytes) {
+        const uint8_t *next = logApplyDelta(ring + start, &firstMs, slots, (uint8_t *)&first);
+        start = next - ring;
+    }
+    putFrame(w, LOG_REC_TICK, &first, sizeof(first), firstMs);
+    if (fill > start) putFrame(w, LOG_REC_TICKS, ring + start, fill - start, firstMs);
+}
+
+int main(int argc, char *argv[])
+{
+    static writer w;
+    logSample sample, prev;
+    logSlot slots[fieldCount];
+    logHeader header;
+    ride r;
+    uint64_t limit = 10 << 20, samples = 0, tornAt = 0;
+    uint32_t seed = 1, ms = 0, lastMs = 0;
+    unsigned keyCount = 0;
+    bool tear = false;
+    int a = 1;
+
+    for (; a < argc && argv[a][0] == '-'; a++) {
+        if (!strcmp(argv[a], "-t")) tear = true;
+        else if (!strcmp(argv[a], "-m") && a + 1 < argc) limit = atof(argv[++a]) * 1048576;
+        else if (!strcmp(argv[a], "-r") && a + 1 < argc) seed = strtoul(argv[++a], NULL, 0) | 1;
+        else break;
+    }
+    if (a + 1 != argc) {
+        fprintf(stderr, "Usage: loggen [-m MB] [-r seed] [-t] OUT.BIN\n");
+        return 1;
+    }
+    if (!(w.f = fopen(argv[a], "w+b"))) {
+        perror(argv[a]);
+        return 1;
+    }
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, "EMTB", 4);
+    header.version = LOG_VERSION;
+    header.fields = fieldCount;
+    header.wheelsize = wheelsize;
+    header.gearratio = gearratio;
+    header.pulse_rpm = pulse_rpm;
+    header.erpm_rpm = erpm_rpm;
+    header.dist_corr_factor = dist_corr_factor;
+    header.ratio_RpmSpeed = ratio_RpmSpeed;
+    header.ratio_TachoDist = ratio_TachoDist;
+    uint16_t crc = logCrc16(0, &header, sizeof(header));
+    crc = logCrc16(crc, logFields, sizeof(logFields));
+    put(&w, &header, sizeof(header));
+    put(&w, logFields, sizeof(logFields));
+    put(&w, &crc, 2);
+    for (uint8_t i = 0; i < fieldCount; i++) {
+        slots[i].offset = logFields[i].offset;
+        slots[i].type = logFields[i].type;
+    }
+
+    memset(&r, 0, sizeof(r));
+    memset(&prev, 0, sizeof(prev));
+    while (w.bytes < limit) {
+        ms += SDrefresh;
+        step(&r, &sample, ms, &seed);
+
+        // Brake and a link loss every 5 minutes dump the loops before them
+        uint8_t events = 0;
+        if (sample.remote.thr < -sample.remote._deadband && prev.remote.thr >= -prev.remote._deadband)
+            events |= LOG_EVT_BRAKE;
+        if (ms % 300000 == 0) events |= LOG_EVT_LINK;
+        if (events) {
+            putFrame(&w, LOG_REC_EVENT, &events, 1, ms);
+            putTicks(&w, slots, &prev, &sample, events, ms);
+        }
+
+        if (!keyCount) {
+            closeBlock(&w);
+            putFrame(&w, LOG_REC_SAMPLE, &sample, sizeof(sample), ms);
+            memcpy(&prev, &sample, sizeof(sample));
+            keyCount = keyInterval;
+        } else {
+            if (w.fill + LOG_DELTA_MAX(fieldCount) > blockSize) closeBlock(&w);
+            if (!w.fill) w.blockMs = lastMs;
+            w.fill = logEncodeDelta(w.block + w.fill, ms - lastMs, slots, fieldCount, (uint8_t *)&prev,
+                                    (const uint8_t *)&sample) - w.block;
+            keyCount--;
+        }
+        lastMs = ms;
+        samples++;
+        if (tear && !tornAt && w.bytes > limit / 2) tornAt = w.bytes + 5;
+    }
+    closeBlock(&w);
+
+    if (tear) {
+        // The power went while the last frame was written, one frame in the middle is damaged
+        w.bytes -= 7;
+        fseek(w.f, tornAt, SEEK_SET);
+        int c = fgetc(w.f);
+        fseek(w.f, tornAt, SEEK_SET);
+        fputc(c ^ 0x5A, w.f);
+        fseek(w.f, w.bytes, SEEK_SET);
+        if (ftruncate(fileno(w.f), w.bytes)) perror(argv[a]);
+    }
+    static const uint8_t zero[sector] = {0};
+    put(&w, zero, (sector - w.bytes % sector) % sector);
+
+    if (fclose(w.f)) {
+        perror(argv[a]);
+        return 1;
+    }
+    fprintf(stderr, "%s: %llu samples, %llu frames, %.1f MB\n", argv[a], (unsigned long long)samples,
+            (unsigned long long)w.frames, w.bytes / 1048576.0);
+    return 0;
+}
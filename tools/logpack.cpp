@@ -0,0 +1,210 @@
+/*
+  logpack - delta compresses EMTB ride logs and reports the compression
+
+  Build:  g++ -O2 -o logpack logpack.cpp
+  Usage:  logpack [-k samples] [-b bytes] IN.BIN [OUT.BIN]
+
+  Reads all samples of IN.BIN and encodes them like SDLog::writeSample():
+  a key frame every -k samples (default 40, as SDLog) and the samples in
+  between delta encoded in LOG_REC_DELTA frames of up to -b payload bytes
+  (default 100, SDLOG_BLOCK). The result is decoded again and compared with
+  the input sample by sample. Event dumps are encoded like the TX does, a
+  LOG_REC_TICK frame and the samples after it in a LOG_REC_TICKS frame
+  (a new pair when 255 bytes are full). Prints the
+  bytes per sample before and after and the compression ratio. OUT.BIN is
+  written if given.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "logreader.h"
+
+struct packer {
+    uint8_t *out;
+    size_t len;
+    uint16_t seq;
+    logSlot slots[LOG_MAX_FIELDS];
+    uint8_t fields;
+    uint8_t prev[256];
+    uint8_t block[256];
+    uint8_t fill;
+    uint32_t blockMs;
+    uint32_t lastMs;
+    uint8_t tickRef[256]; // last sample of the event dump
+    uint8_t ticks[255];   // deltas after the LOG_REC_TICK
+    uint8_t tickFill;
+    uint32_t tickMs;      // of the LOG_REC_TICK
+    uint32_t tickLastMs;
+};
+
+static void putFrame(packer *pk, uint8_t type, const uint8_t *data, uint8_t len, uint32_t ms)
+{
+    logFrame frame;
+    uint16_t crc;
+
+    frame.sync = LOG_SYNC;
+    frame.type = type;
+    frame.len = len;
+    frame.seq = pk->seq++;
+    frame.ms = ms;
+    crc = logCrcFast(0, &frame.type, sizeof(logFrame) - 1);
+    crc = logCrcFast(crc, data, len);
+    memcpy(pk->out + pk->len, &frame, sizeof(logFrame));
+    memcpy(pk->out + pk->len + sizeof(logFrame), data, len);
+    memcpy(pk->out + pk->len + sizeof(logFrame) + len, &crc, 2);
+    pk->len += sizeof(logFrame) + len + 2;
+}
+
+// Next regular sample, or next event dump sample if ticks is set
+static const uint8_t *nextOfKind(logReader *r, bool ticks)
+{
+    const uint8_t *sample;
+    while ((sample = logNextSample(r)) && r->isTick != ticks)
+        ;
+    return sample;
+}
+
+static void closeBlock(packer *pk)
+{
+    if (pk->fill) putFrame(pk, LOG_REC_DELTA, pk->block, pk->fill, pk->blockMs);
+    pk->fill = 0;
+}
+
+static void closeTicks(packer *pk)
+{
+    if (pk->tickFill) putFrame(pk, LOG_REC_TICKS, pk->ticks, pk->tickFill, pk->tickMs);
+    pk->tickFill = 0;
+}
+
+// Adds a sample to the open event dump, or starts one with a LOG_REC_TICK frame
+static void putTick(packer *pk, const uint8_t *sample, uint8_t len, uint32_t ms, bool start)
+{
+    uint8_t delta[LOG_DELTA_MAX(LOG_MAX_FIELDS)];
+    uint8_t n = 0;
+
+    if (!start) n = logEncodeDelta(delta, ms - pk->tickLastMs, pk->slots, pk->fields, pk->tickRef, sample) - delta;
+    if (start || pk->tickFill + n > sizeof(pk->ticks)) {
+        closeTicks(pk);
+        putFrame(pk, LOG_REC_TICK, sample, len, ms);
+        memcpy(pk->tickRef, sample, len);
+        pk->tickMs = ms;
+    } else {
+        memcpy(pk->ticks + pk->tickFill, delta, n);
+        pk->tickFill += n;
+    }
+    pk->tickLastMs = ms;
+}
+
+int main(int argc, char *argv[])
+{
+    static logReader in, check;
+    static packer pk;
+    unsigned keyInterval = 40, blockSize = 100, keyCount = 0;
+    size_t inBytes, headerBytes, mismatches = 0;
+    uint64_t events = 0;
+    const uint8_t *sample;
+    const char *err;
+    int a = 1;
+
+    for (; a + 1 < argc && argv[a][0] == '-'; a += 2) {
+        if (!strcmp(argv[a], "-k")) keyInterval = atoi(argv[a + 1]);
+        else if (!strcmp(argv[a], "-b")) blockSize = atoi(argv[a + 1]);
+        else break;
+    }
+    if (a >= argc || a + 2 < argc || argv[a][0] == '-' || keyInterval > 255 || blockSize > 255) {
+        fprintf(stderr, "Usage: logpack [-k samples] [-b bytes] IN.BIN [OUT.BIN]\n");
+        return 1;
+    }
+    if ((err = logOpen(&in, argv[a]))) {
+        fprintf(stderr, "%s: %s\n", argv[a], err);
+        return 1;
+    }
+    pk.fields = in.header.fields;
+    if (pk.fields > 32 || (unsigned)LOG_DELTA_MAX(pk.fields) > blockSize) {
+        fprintf(stderr, "%s: %u fields don't fit a delta frame of %u bytes\n", argv[a], pk.fields, blockSize);
+        return 1;
+    }
+    for (uint8_t i = 0; i < pk.fields; i++) {
+        pk.slots[i].offset = in.fields[i].offset;
+        pk.slots[i].type = in.fields[i].type;
+    }
+
+    // Same header, only the version changes
+    headerBytes = in.pos;
+    pk.out = (uint8_t *)malloc(headerBytes + in.size * 2 + 4096);
+    memcpy(pk.out, in.data, headerBytes);
+    pk.out[offsetof(logHeader, version)] = LOG_VERSION;
+    uint16_t crc = logCrcFast(0, pk.out, headerBytes - 2);
+    memcpy(pk.out + headerBytes - 2, &crc, 2);
+    pk.len = headerBytes;
+
+    inBytes = headerBytes;
+    in.ticks = true;
+    while ((sample = logNextSample(&in))) {
+        inBytes = in.pos;
+        if (in.isTick) {
+            bool start = in.eventFrames != events;
+            if (start) {
+                closeTicks(&pk);
+                putFrame(&pk, LOG_REC_EVENT, &in.events, 1, in.ms);
+                events = in.eventFrames;
+            }
+            putTick(&pk, sample, in.payloadMin, in.ms, start);
+            continue;
+        }
+        closeTicks(&pk);
+        if (!keyCount) {
+            closeBlock(&pk);
+            putFrame(&pk, LOG_REC_SAMPLE, sample, in.payloadMin, in.ms);
+            memcpy(pk.prev, sample, in.payloadMin);
+            keyCount = keyInterval;
+        } else {
+            // Room for the worst case first, like SDLog
+            if (pk.fill + (unsigned)LOG_DELTA_MAX(pk.fields) > blockSize) closeBlock(&pk);
+            if (!pk.fill) pk.blockMs = pk.lastMs;
+            pk.fill = logEncodeDelta(pk.block + pk.fill, in.ms - pk.lastMs, pk.slots, pk.fields, pk.prev, sample) - pk.block;
+            keyCount--;
+        }
+        pk.lastMs = in.ms;
+    }
+    closeTicks(&pk);
+    closeBlock(&pk);
+
+    // Decode the result again and compare it with the input. Event dumps may
+    // move before the delta frame that was open, so both kinds are compared apart.
+    for (int ticks = 0; ticks < 2; ticks++) {
+        logClose(&in);
+        logOpen(&in, argv[a]);
+        if ((err = logAttach(&check, pk.out, pk.len))) {
+            fprintf(stderr, "packed log: %s\n", err);
+            return 1;
+        }
+        in.ticks = check.ticks = true;
+        while ((sample = nextOfKind(&in, ticks))) {
+            const uint8_t *packed = nextOfKind(&check, ticks);
+            if (!packed || check.ms != in.ms || (ticks && check.events != in.events) || memcmp(packed, sample, in.payloadMin))
+                mismatches++;
+        }
+        if (nextOfKind(&check, ticks)) mismatches++;
+    }
+
+    if (a + 1 < argc) {
+        FILE *f = fopen(argv[a + 1], "wb");
+        if (!f || fwrite(pk.out, 1, pk.len, f) != pk.len) {
+            perror(argv[a + 1]);
+            return 1;
+        }
+        fclose(f);
+    }
+
+    if (pk.len > headerBytes) {
+        printf("%s: %llu samples, %.1f -> %.1f bytes per sample, ratio %.2f, %llu mismatches\n", argv[a],
+               (unsigned long long)in.samples, (double)(inBytes - headerBytes) / in.samples,
+               (double)(pk.len - headerBytes) / in.samples, (double)(inBytes - headerBytes) / (pk.len - headerBytes),
+               (unsigned long long)mismatches);
+    }
+    logClose(&in);
+    free(pk.out);
+    return mismatches ? 1 : 0;
+}
@@ -0,0 +1,353 @@
+/*
+  logreader.h - streaming reader for the EMTB ride logs (LOGnnn.BIN)
+
+  Header only, used by the host tools in this directory. The log is mapped
+  with mmap and the frames are returned in place, nothing is copied or
+  allocated per frame. A frame with a bad CRC or a torn tail is skipped by
+  scanning for the next LOG_SYNC that starts a valid frame.
+
+  logNextSample() decodes key and delta frames into one sample buffer.
+  The event dumps (LOG_REC_TICK and LOG_REC_TICKS) are only returned if
+  ticks is set, decoded into a buffer of their own.
+*/
+
+#ifndef logreader_h
+#define logreader_h
+
+#include <fcntl.h>
+#include <math.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "../libraries/SDLog/LogFormat.h"
+
+#define LOG_MAX_FIELDS 64
+
+struct logReader {
+    const uint8_t *data;
+    size_t size;
+    size_t pos;
+    bool mapped;            // data was mapped by logOpen()
+    logHeader header;
+    logField fields[LOG_MAX_FIELDS];
+    uint8_t payloadMin;     // payload bytes needed by the field table
+    bool inSync;            // the last frame was valid, the next one should follow directly
+    uint16_t lastSeq;
+    // sample decoding
+    uint8_t sample[256];    // current sample, also the reference for the next delta
+    bool chain;             // sample is valid as reference
+    const uint8_t *block;   // rest of the current delta frame
+    const uint8_t *blockEnd;
+    bool tickBlock;         // the delta frame is a LOG_REC_TICKS frame, it decodes into tick
+    bool tickChain;         // tick is valid as reference
+    uint32_t ms;            // timestamp of sample
+    bool ticks;             // set by the caller to get the event dumps too
+    bool isTick;            // the returned sample is from an event dump
+    uint8_t events;         // LOG_EVT_ bits of the last event frame
+    uint8_t tick[256];
+    // statistics
+    uint64_t frames;        // valid frames
+    uint64_t lostFrames;    // gaps in the sequence numbers
+    uint64_t badFrames;     // frames expected at a position that did not validate
+    uint64_t skipped;       // non zero bytes skipped while searching the next frame
+    uint64_t samples;       // samples returned by logNextSample()
+    uint64_t unresolved;    // delta frames dropped because their reference was lost
+    uint64_t eventFrames;   // LOG_REC_EVENT frames
+    uint64_t eventCount[8]; // LOG_REC_EVENT frames per LOG_EVT_ bit
+};
+
+// The table of logCrcFast(), built on the first call. The threads of logstats
+// open logs at the same time, C++11 builds a local static exactly once for them.
+static inline const uint16_t *logCrcTable()
+{
+    static const struct table {
+        uint16_t crc[256];
+        table()
+        {
+            for (uint16_t i = 0; i < 256; i++) {
+                uint8_t b = i;
+                crc[i] = logCrc16(0, &b, 1);
+            }
+        }
+    } t;
+    return t.crc;
+}
+
+static inline uint16_t logCrcFast(uint16_t crc, const uint8_t *p, size_t len)
+{
+    const uint16_t *table = logCrcTable();
+    while (len--)
+        crc = (crc << 8) ^ table[(crc >> 8) ^ *p++];
+    return crc;
+}
+
+// Reads a log that is already in memory and checks the header
+// Returns NULL on success or a message why the log can't be read
+static const char *logAttach(logReader *r, const uint8_t *data, size_t size)
+{
+    uint16_t crc;
+    size_t n;
+
+    memset(r, 0, sizeof(logReader));
+    r->data = data;
+    r->size = size;
+    if (r->size < sizeof(logHeader)) return "no log header";
+    memcpy(&r->header, r->data, sizeof(logHeader));
+    if (memcmp(r->header.magic, "EMTB", 4)) return "not an EMTB log";
+    if (r->header.version > LOG_VERSION) return "log format is newer than this tool";
+    if (r->header.fields > LOG_MAX_FIELDS) return "too many fields";
+
+    n = sizeof(logHeader) + r->header.fields * sizeof(logField);
+    if (r->size < n + 2) return "truncated header";
+    memcpy(r->fields, r->data + sizeof(logHeader), r->header.fields * sizeof(logField));
+    memcpy(&crc, r->data + n, 2);
+    if (logCrcFast(0, r->data, n) != crc) return "header CRC error";
+
+    for (uint8_t i = 0; i < r->header.fields; i++) {
+        r->fields[i].name[LOG_NAME_LEN - 1] = 0;
+        if (r->fields[i].offset + logTypeSize(r->fields[i].type) > r->payloadMin)
+            r->payloadMin = r->fields[i].offset + logTypeSize(r->fields[i].type);
+    }
+    r->pos = n + 2;
+    r->inSync = true;
+    return NULL;
+}
+
+// Maps the file and checks the header
+// Returns NULL on success or a message why the file can't be read
+static const char *logOpen(logReader *r, const char *path)
+{
+    struct stat st;
+    const uint8_t *data;
+    const char *err;
+    int fd;
+
+    memset(r, 0, sizeof(logReader));
+    fd = open(path, O_RDONLY);
+    if (fd < 0) return "can't open file";
+    if (fstat(fd, &st) || st.st_size < (off_t)sizeof(logHeader)) {
+        close(fd);
+        return "no log header";
+    }
+    data = (const uint8_t *)mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) return "mmap failed";
+    madvise((void *)data, st.st_size, MADV_SEQUENTIAL);
+
+    err = logAttach(r, data, st.st_size);
+    r->mapped = true;
+    return err;
+}
+
+static void logClose(logReader *r)
+{
+    if (r->mapped) munmap((void *)r->data, r->size);
+    r->data = NULL;
+    r->mapped = false;
+}
+
+static inline const uint8_t *logGetVarint(const uint8_t *p, const uint8_t *end, uint32_t *v)
+{
+    uint32_t x = 0;
+
+    for (uint8_t shift = 0; p < end && shift < 35; shift += 7) {
+        x |= (uint32_t)(*p & 0x7F) << shift;
+        if (!(*p++ & 0x80)) {
+            *v = x;
+            return p;
+        }
+    }
+    return NULL;
+}
+
+// Returns the next valid frame and its payload, NULL at the end of the file
+static inline const logFrame *logNext(logReader *r, const uint8_t **payload)
+{
+    const uint8_t *end = r->data + r->size;
+    const uint8_t *p = r->data + r->pos;
+
+    while (p + sizeof(logFrame) + 2 <= end) {
+        if (*p == LOG_SYNC) {
+            const logFrame *f = (const logFrame *)p;
+            size_t n = sizeof(logFrame) + f->len;
+            uint16_t crc;
+            if (p + n + 2 <= end) {
+                memcpy(&crc, p + n, 2);
+                if (logCrcFast(0, p + 1, n - 1) == crc) {
+                    if (r->frames && (uint16_t)(f->seq - r->lastSeq) != 1)
+                        r->lostFrames += (uint16_t)(f->seq - r->lastSeq - 1);
+                    r->lastSeq = f->seq;
+                    r->frames++;
+                    r->inSync = true;
+                    r->pos = p + n + 2 - r->data;
+                    *payload = p + sizeof(logFrame);
+                    return f;
+                }
+            }
+            if (r->inSync) r->badFrames++;
+        } else if (*p && *p != 0xFF) { // the unused end is zero filled or erased
+            if (r->inSync) r->badFrames++;
+            r->skipped++;
+        }
+        r->inSync = false;
+        p++;
+    }
+    // Whatever is left is too short for a frame, the zero filled or erased end is not counted
+    for (; p < end; p++)
+        if (*p && *p != 0xFF) r->skipped++;
+    r->pos = r->size;
+    return NULL;
+}
+
+// Index of a field in the field table, -1 if the log doesn't have it
+static inline int logFieldIndex(const logReader *r, const char *name)
+{
+    for (uint8_t i = 0; i < r->header.fields; i++)
+        if (!strcmp(r->fields[i].name, name)) return i;
+    return -1;
+}
+
+// Applies the next delta encoded sample of the current frame to sample
+// Returns false if the frame is malformed
+static inline bool logDecodeDelta(logReader *r, uint8_t *sample)
+{
+    const uint8_t *p = r->block;
+    uint32_t v, mask;
+
+    if (!(p = logGetVarint(p, r->blockEnd, &v))) return false;
+    r->ms += v;
+    if (!(p = logGetVarint(p, r->blockEnd, &mask))) return false;
+    for (uint8_t i = 0; mask; i++, mask >>= 1) {
+        if (!(mask & 1)) continue;
+        if (i >= r->header.fields || !(p = logGetVarint(p, r->blockEnd, &v))) return false;
+        uint8_t *o = sample + r->fields[i].offset;
+        logPutRaw(o, r->fields[i].type, logGetRaw(o, r->fields[i].type) + logUnzigzag(v));
+    }
+    r->block = p;
+    return true;
+}
+
+// Returns the next sample (at least payloadMin bytes) with its time in r->ms, NULL at the end of the file
+static inline const uint8_t *logNextSample(logReader *r)
+{
+    const uint8_t *payload;
+    const logFrame *f;
+    uint64_t errors;
+
+    r->isTick = false;
+    for (;;) {
+        if (r->block < r->blockEnd) {
+            uint8_t *sample = r->tickBlock ? r->tick : r->sample;
+            if (logDecodeDelta(r, sample)) {
+                r->isTick = r->tickBlock;
+                r->samples++;
+                return sample;
+            }
+            r->unresolved++;
+            if (r->tickBlock) r->tickChain = false;
+            else r->chain = false;
+            r->block = r->blockEnd;
+        }
+
+        errors = r->lostFrames + r->badFrames;
+        if (!(f = logNext(r, &payload))) return NULL;
+        if (r->lostFrames + r->badFrames != errors) r->chain = r->tickChain = false;
+
+        if (f->type == LOG_REC_SAMPLE && f->len >= r->payloadMin) {
+            memcpy(r->sample, payload, f->len);
+            r->ms = f->ms;
+            r->chain = true;
+            r->samples++;
+            return r->sample;
+        }
+        if (f->type == LOG_REC_DELTA) {
+            if (!r->chain) {
+                r->unresolved++;
+                continue;
+            }
+            r->ms = f->ms;
+            r->block = payload;
+            r->blockEnd = payload + f->len;
+            r->tickBlock = false;
+        }
+        if (f->type == LOG_REC_EVENT && f->len) {
+            r->events = payload[0];
+            r->eventFrames++;
+            for (uint8_t i = 0; i < 8; i++)
+                if (r->events & (1 << i)) r->eventCount[i]++;
+        }
+        if (f->type == LOG_REC_TICK && r->ticks && f->len >= r->payloadMin) {
+            // Leaves sample alone, it is still the reference for the next delta
+            memcpy(r->tick, payload, f->len);
+            r->tickChain = true;
+            r->isTick = true;
+            r->samples++;
+            r->ms = f->ms; // a delta frame starts from its own frame.ms
+            return r->tick;
+        }
+        if (f->type == LOG_REC_TICKS && r->ticks) {
+            if (!r->tickChain) {
+                r->unresolved++;
+                continue;
+            }
+            r->ms = f->ms;
+            r->block = payload;
+            r->blockEnd = payload + f->len;
+            r->tickBlock = true;
+        }
+    }
+}
+
+// Scaled value of a field, the payload has to hold at least payloadMin bytes
+static inline double logValue(const logField *f, const uint8_t *payload)
+{
+    const uint8_t *p = payload + f->offset;
+    double v;
+
+    switch (f->type) {
+    case LOG_U8:
+    case LOG_BOOL:
+        v = *p;
+        break;
+    case LOG_I8:
+        v = (int8_t)*p;
+        break;
+    case LOG_U16: {
+        uint16_t x;
+        memcpy(&x, p, 2);
+        v = x;
+        break;
+    }
+    case LOG_I16: {
+        int16_t x;
+        memcpy(&x, p, 2);
+        v = x;
+        break;
+    }
+    case LOG_U32: {
+        uint32_t x;
+        memcpy(&x, p, 4);
+        v = x;
+        break;
+    }
+    case LOG_I32: {
+        int32_t x;
+        memcpy(&x, p, 4);
+        v = x;
+        break;
+    }
+    case LOG_F32: {
+        float x;
+        memcpy(&x, p, 4);
+        v = x;
+        break;
+    }
+    default:
+        return NAN;
+    }
+    return v * f->scale;
+}
+
+#endif
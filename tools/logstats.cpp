@@ -0,0 +1,231 @@
+/*
+  logstats - ride and fleet statistics from EMTB ride logs (LOGnnn.BIN)
+
+  Build:  g++ -O2 -pthread -I../libraries/EnergyMeter -o logstats logstats.cpp \
+              ../libraries/EnergyMeter/EnergyMeter.cpp
+  Usage:  logstats [-j threads] LOGnnn.BIN...
+
+  Every log is read in one pass by one of the worker threads (default one
+  per core). Prints one CSV line per ride and a total line for all rides:
+
+    duration_s    time covered by the samples
+    distance_km   tachometerAbs * ratio_TachoDist of the log header, counter
+                  resets of the VESC are skipped
+    top_kmh       highest rpm * ratio_RpmSpeed
+    energy_wh     v_in * current_in integrated over time, regenerated energy
+                  counts negative
+    wh_km         energy_wh / distance_km
+    meter_wh      energy of the TX EnergyMeter fed with the logged samples,
+                  from amp_hours and amp_hours_charged, a check of its
+                  fixed point against energy_wh
+    ir_mohm       internal resistance estimate of the EnergyMeter at the end,
+                  starting from the 150 mOhm of the TX. The total line has
+                  the mean of the rides weighted by their duration.
+    peak_motor_a  highest |current_motor|
+    rms_motor_a   time weighted RMS of current_motor
+    peak_in_a     highest current_in
+    brake_s       time with thr below -deadband
+    max_loop_ms   longest TX loop, stick to radio lag
+    max_age_ms    oldest VESC values the TX used, 0 for logs without
+                  loop_max and vesc_age
+    link_loss     LOG_EVT_LINK events
+    radio_fail    LOG_EVT_RADIO events
+    lost, bad     lost and bad frames, a torn end of the log counts as bad
+
+  Gaps longer than maxGap between two samples (lost frames, a paused log)
+  are left out of all time based values. The throughput goes to stderr.
+*/
+
+#include <atomic>
+#include <stdio.h>
+#include <stdlib.h>
+#include <thread>
+#include <time.h>
+#include <vector>
+
+#include "EnergyMeter.h"
+#include "logreader.h"
+
+static const uint32_t maxGap = 2000;    // [ms]
+static const uint16_t batteryRes = 150; // [mOhm] EnergyMeter start value of EMTB_TX.cpp
+
+struct rideStats {
+    const char *error;
+    uint64_t bytes;
+    double duration;  // [s]
+    double distance;  // [km]
+    double topSpeed;  // [km/h]
+    double energy;    // [Wh]
+    double meter;     // [Wh]
+    double res;       // [mOhm]
+    double peakMotor; // [A]
+    double sumSquare; // [A^2 s] of current_motor
+    double peakIn;    // [A]
+    double brake;     // [s]
+    double maxLoop;   // [ms]
+    double maxAge;    // [ms]
+    uint64_t link;
+    uint64_t radio;
+    uint64_t lost;
+    uint64_t bad;
+};
+
+static void ride(const char *path, rideStats *st)
+{
+    static __thread logReader r; // 1.6 kB per thread, not on the stack
+    EnergyMeter meter;
+    const uint8_t *sample;
+    bool first = true;
+    uint32_t lastMs = 0;
+    double lastTacho = 0;
+
+    memset(st, 0, sizeof(rideStats));
+    if ((st->error = logOpen(&r, path))) {
+        logClose(&r);
+        return;
+    }
+    st->bytes = r.size;
+
+    int fMotor = logFieldIndex(&r, "current_motor");
+    int fIn = logFieldIndex(&r, "current_in");
+    int fVolt = logFieldIndex(&r, "v_in");
+    int fRpm = logFieldIndex(&r, "rpm");
+    int fTacho = logFieldIndex(&r, "tachometerAbs");
+    int fThr = logFieldIndex(&r, "thr");
+    int fDead = logFieldIndex(&r, "deadband");
+    int fLoop = logFieldIndex(&r, "loop_max");
+    int fAge = logFieldIndex(&r, "vesc_age");
+    int fAh = logFieldIndex(&r, "amp_hours");
+    int fAhc = logFieldIndex(&r, "amp_hours_charged");
+
+    meter.distance(1 / r.header.ratio_TachoDist);
+    meter.resistance(batteryRes);
+
+    while ((sample = logNextSample(&r))) {
+        double motor = fMotor < 0 ? 0 : logValue(&r.fields[fMotor], sample);
+        double in = fIn < 0 ? 0 : logValue(&r.fields[fIn], sample);
+        double tacho = fTacho < 0 ? 0 : logValue(&r.fields[fTacho], sample);
+
+        if (fabs(motor) > st->peakMotor) st->peakMotor = fabs(motor);
+        if (in > st->peakIn) st->peakIn = in;
+        if (fLoop >= 0 && logValue(&r.fields[fLoop], sample) > st->maxLoop)
+            st->maxLoop = logValue(&r.fields[fLoop], sample);
+        if (fAge >= 0 && logValue(&r.fields[fAge], sample) > st->maxAge)
+            st->maxAge = logValue(&r.fields[fAge], sample);
+        if (fRpm >= 0) {
+            double speed = fabs(logValue(&r.fields[fRpm], sample)) * r.header.ratio_RpmSpeed;
+            if (speed > st->topSpeed) st->topSpeed = speed;
+        }
+        if (fVolt >= 0 && fAh >= 0 && fAhc >= 0) // back to the fixed point steps the TX gets
+            meter.update(lround(logValue(&r.fields[fVolt], sample) * 10), lround(in * 100),
+                         lround(logValue(&r.fields[fAh], sample) * 10000),
+                         lround(logValue(&r.fields[fAhc], sample) * 10000), lround(tacho));
+
+        if (first) {
+            first = false;
+        } else {
+            uint32_t dms = r.ms - lastMs;
+            if (dms <= maxGap) {
+                double dt = dms / 1000.0;
+                st->duration += dt;
+                if (fVolt >= 0) st->energy += logValue(&r.fields[fVolt], sample) * in * dt / 3600;
+                st->sumSquare += motor * motor * dt;
+                if (fThr >= 0 && fDead >= 0 && logValue(&r.fields[fThr], sample) < -logValue(&r.fields[fDead], sample))
+                    st->brake += dt;
+            }
+            if (tacho > lastTacho) st->distance += (tacho - lastTacho) * r.header.ratio_TachoDist;
+        }
+        lastTacho = tacho;
+        lastMs = r.ms;
+    }
+
+    st->meter = meter.used() / 10.0;
+    st->res = meter.resistance();
+    st->link = r.eventCount[0];  // LOG_EVT_LINK
+    st->radio = r.eventCount[1]; // LOG_EVT_RADIO
+    st->lost = r.lostFrames;
+    st->bad = r.badFrames;
+    logClose(&r);
+}
+
+static void print(const char *name, const rideStats *st)
+{
+    printf("%s,%.1f,%.3f,%.1f,%.2f,%.2f,%.1f,%.0f,%.2f,%.2f,%.2f,%.1f,%.0f,%.0f,%llu,%llu,%llu,%llu\n", name,
+           st->duration, st->distance, st->topSpeed, st->energy, st->distance > 0 ? st->energy / st->distance : 0,
+           st->meter, st->res, st->peakMotor,
+           st->duration > 0 ? sqrt(st->sumSquare / st->duration) : 0, st->peakIn, st->brake, st->maxLoop, st->maxAge,
+           (unsigned long long)st->link, (unsigned long long)st->radio, (unsigned long long)st->lost,
+           (unsigned long long)st->bad);
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned threads = std::thread::hardware_concurrency();
+    std::vector<std::thread> workers;
+    std::atomic<int> next;
+    struct timespec t0, t1;
+    rideStats total;
+    int first = 1, files;
+
+    if (argc > 2 && !strcmp(argv[1], "-j")) {
+        threads = atoi(argv[2]);
+        first = 3;
+    }
+    if (first >= argc) {
+        fprintf(stderr, "Usage: logstats [-j threads] LOGnnn.BIN...\n");
+        return 1;
+    }
+    files = argc - first;
+    if (threads < 1) threads = 1;
+    if ((int)threads > files) threads = files;
+
+    std::vector<rideStats> stats(files);
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    next = 0;
+    for (unsigned t = 0; t < threads; t++) {
+        workers.push_back(std::thread([&]() {
+            int i;
+            while ((i = next++) < files)
+                ride(argv[first + i], &stats[i]);
+        }));
+    }
+    for (unsigned t = 0; t < threads; t++)
+        workers[t].join();
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    printf("ride,duration_s,distance_km,top_kmh,energy_wh,wh_km,meter_wh,ir_mohm,peak_motor_a,rms_motor_a,peak_in_a,brake_s,"
+           "max_loop_ms,max_age_ms,link_loss,radio_fail,lost,bad\n");
+    memset(&total, 0, sizeof(total));
+    for (int i = 0; i < files; i++) {
+        const rideStats *st = &stats[i];
+        if (st->error) {
+            fprintf(stderr, "%s: %s\n", argv[first + i], st->error);
+            continue;
+        }
+        print(argv[first + i], st);
+        total.bytes += st->bytes;
+        total.duration += st->duration;
+        total.distance += st->distance;
+        total.energy += st->energy;
+        total.meter += st->meter;
+        total.sumSquare += st->sumSquare;
+        total.brake += st->brake;
+        total.link += st->link;
+        total.radio += st->radio;
+        total.lost += st->lost;
+        total.bad += st->bad;
+        if (st->topSpeed > total.topSpeed) total.topSpeed = st->topSpeed;
+        if (st->peakMotor > total.peakMotor) total.peakMotor = st->peakMotor;
+        if (st->peakIn > total.peakIn) total.peakIn = st->peakIn;
+        if (st->maxLoop > total.maxLoop) total.maxLoop = st->maxLoop;
+        if (st->maxAge > total.maxAge) total.maxAge = st->maxAge;
+        total.res += st->res * st->duration;
+    }
+    if (total.duration > 0) total.res /= total.duration;
+    print("total", &total);
+
+    double seconds = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+    fprintf(stderr, "%d logs, %.1f MB in %.2f s, %.0f MB/s with %u threads\n", files, total.bytes / 1e6, seconds,
+            seconds > 0 ? total.bytes / 1e6 / seconds : 0, threads);
+    return 0;
+}
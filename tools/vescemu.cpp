@@ -0,0 +1,255 @@
+/*
+  vescemu - emulates a VESC on a pseudo terminal
+
+  Build:  g++ -O2 -I../libraries/VescUartControl -o vescemu vescemu.cpp \
+              ../libraries/VescUartControl/crc.cpp ../libraries/VescUartControl/buffer.cpp
+  Usage:  vescemu [-l link] [-s script] [-d ms] [-c prob] [-p prob] [-r seed]
+
+  Opens a pty and prints the name of its slave side, -l also creates a
+  symlink to it. A program (or a USB-serial bridge to a board) that opens
+  it talks to a VESC: frames are packed and checked with the crc16() and
+  buffer_*() of VescUartControl, so both sides use the same code.
+
+  COMM_GET_VALUES is answered from the motor and battery model of
+  vescmodel.h, the set commands drive it. A script changes the model over
+  time, one "ms name value" per line:
+
+    v_batt   open circuit voltage [V]      (42)
+    r_batt   internal resistance [Ohm]     (0.1)
+    load     hill / rider load [A]         (1)
+
+  Faults for the receiving side:
+
+    -d ms    answer ms late
+    -c prob  flip one byte of an answer with this probability (0..1)
+    -p prob  send only the first part of an answer
+
+  Every received command is written as CSV to stdout: ms since start, ms
+  since the previous command, command and value (A, duty or erpm). Bad
+  frames show up as bad_crc. At the end (Ctrl-C) the command count, rate,
+  mean interval and jitter (standard deviation) go to stderr.
+*/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <math.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "vescmodel.h"
+
+struct scriptLine {
+    uint32_t ms;
+    char name[16];
+    double value;
+};
+
+static volatile sig_atomic_t stop;
+static struct timespec start;
+
+static uint32_t now()
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (t.tv_sec - start.tv_sec) * 1000 + (t.tv_nsec - start.tv_nsec) / 1000000;
+}
+
+static void onSignal(int) { stop = 1; }
+
+struct pending {
+    uint32_t due;
+    int len;
+    uint8_t frame[262];
+};
+
+struct cmdStats {
+    uint64_t count;
+    uint32_t first, last;
+    double sum, sumSquare; // of the intervals
+};
+
+static double randomUnit(unsigned *seed) { return rand_r(seed) / (RAND_MAX + 1.0); }
+
+// Logs every command, the answers get the faults
+struct emulator {
+    cmdStats st;
+    pending out;
+    int delay;
+    double corrupt, partial;
+    unsigned seed;
+};
+
+static void onCommand(void *ctx, uint32_t ms, const char *name, double value, bool valid)
+{
+    cmdStats *st = &((emulator *)ctx)->st;
+
+    if (!valid) {
+        printf("%u,,%s,%g\n", ms, name, value);
+        return;
+    }
+    if (st->count) {
+        double dt = ms - st->last;
+        st->sum += dt;
+        st->sumSquare += dt * dt;
+        printf("%u,%u,%s,%g\n", ms, ms - st->last, name, value);
+    } else {
+        st->first = ms;
+        printf("%u,,%s,%g\n", ms, name, value);
+    }
+    st->count++;
+    st->last = ms;
+}
+
+// Takes the answer of the model, unless the last one is still being sent
+static void schedule(vescModel *m, emulator *e, uint32_t ms)
+{
+    pending *out = &e->out;
+
+    if (!m->answerLen) return;
+    if (!out->len) {
+        memcpy(out->frame, m->answer, m->answerLen);
+        out->len = m->answerLen;
+        out->due = ms + e->delay;
+        if (randomUnit(&e->seed) < e->corrupt)
+            out->frame[1 + rand_r(&e->seed) % (out->len - 1)] ^= 1 << (rand_r(&e->seed) % 8);
+        if (randomUnit(&e->seed) < e->partial)
+            out->len = 1 + rand_r(&e->seed) % (out->len - 1);
+    }
+    m->answerLen = 0;
+}
+
+static int loadScript(const char *path, scriptLine **lines)
+{
+    FILE *f = fopen(path, "r");
+    char buf[128];
+    int n = 0, size = 0;
+
+    if (!f)
+        return -1;
+    while (fgets(buf, sizeof(buf), f)) {
+        scriptLine l;
+        if (buf[0] == '#' || sscanf(buf, "%u %15s %lf", &l.ms, l.name, &l.value) != 3)
+            continue;
+        if (n == size) {
+            size = size ? size * 2 : 32;
+            *lines = (scriptLine *)realloc(*lines, size * sizeof(scriptLine));
+        }
+        (*lines)[n++] = l;
+    }
+    fclose(f);
+    return n;
+}
+
+static void apply(vescModel *m, const scriptLine *l)
+{
+    if (!vescSet(m, l->name, l->value))
+        fprintf(stderr, "script: unknown %s\n", l->name);
+}
+
+int main(int argc, char *argv[])
+{
+    const char *link = 0, *script = 0;
+    emulator e;
+    scriptLine *lines = 0;
+    int nLines = 0, nextLine = 0;
+    int opt;
+
+    memset(&e, 0, sizeof(e));
+    e.seed = 1;
+    while ((opt = getopt(argc, argv, "l:s:d:c:p:r:")) != -1) {
+        switch (opt) {
+        case 'l': link = optarg; break;
+        case 's': script = optarg; break;
+        case 'd': e.delay = atoi(optarg); break;
+        case 'c': e.corrupt = atof(optarg); break;
+        case 'p': e.partial = atof(optarg); break;
+        case 'r': e.seed = atoi(optarg); break;
+        default:
+            fprintf(stderr, "Usage: vescemu [-l link] [-s script] [-d ms] [-c prob] [-p prob] [-r seed]\n");
+            return 1;
+        }
+    }
+    if (script && (nLines = loadScript(script, &lines)) < 0) {
+        fprintf(stderr, "%s: %s\n", script, strerror(errno));
+        return 1;
+    }
+
+    int master = posix_openpt(O_RDWR | O_NOCTTY);
+    if (master < 0 || grantpt(master) || unlockpt(master)) {
+        perror("pty");
+        return 1;
+    }
+    const char *name = ptsname(master);
+    // Keep the slave side open, else reading the master fails while no client is connected
+    int slave = open(name, O_RDWR | O_NOCTTY);
+    struct termios tio;
+    if (slave < 0 || tcgetattr(slave, &tio)) {
+        perror(name);
+        return 1;
+    }
+    cfmakeraw(&tio);
+    tcsetattr(slave, TCSANOW, &tio);
+    if (link) {
+        unlink(link);
+        if (symlink(name, link)) {
+            perror(link);
+            return 1;
+        }
+    }
+    fprintf(stderr, "VESC on %s%s%s\n", name, link ? " -> " : "", link ? link : "");
+
+    signal(SIGINT, onSignal);
+    signal(SIGTERM, onSignal);
+    setvbuf(stdout, 0, _IOLBF, 0);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    printf("ms,dt_ms,command,value\n");
+
+    vescModel m;
+    vescInit(&m);
+    m.onCommand = onCommand;
+    m.ctx = &e;
+    uint32_t modelMs = 0;
+
+    while (!stop) {
+        struct pollfd p = {master, POLLIN, 0};
+        poll(&p, 1, 1);
+        uint32_t ms = now();
+
+        for (; modelMs < ms; modelMs++) {
+            while (nextLine < nLines && lines[nextLine].ms <= modelMs)
+                apply(&m, &lines[nextLine++]);
+            vescStep(&m, modelMs);
+        }
+        if (e.out.len && ms >= e.out.due) {
+            if (write(master, e.out.frame, e.out.len) < 0)
+                perror("write");
+            e.out.len = 0;
+        }
+        if (!(p.revents & POLLIN))
+            continue;
+
+        uint8_t buf[256];
+        int n = read(master, buf, sizeof(buf));
+        if (n > 0) vescReceive(&m, buf, n, ms);
+        schedule(&m, &e, ms);
+    }
+
+    if (link)
+        unlink(link);
+    const cmdStats &st = e.st;
+    double intervals = st.count > 1 ? st.count - 1 : 0;
+    double mean = intervals ? st.sum / intervals : 0;
+    fprintf(stderr, "%llu commands, %.1f/s, interval %.2f ms, jitter %.2f ms\n", (unsigned long long)st.count,
+            st.last > st.first ? intervals * 1000 / (st.last - st.first) : 0, mean,
+            intervals ? sqrt(st.sumSquare / intervals - mean * mean) : 0);
+    close(slave);
+    close(master);
+    free(lines);
+    return 0;
+}
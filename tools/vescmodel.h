@@ -0,0 +1,269 @@
+/*
+  vescmodel.h - a VESC with motor and battery, fed with the bytes of the UART
+
+  Header only, used by vescemu in this directory and by the VescModel of the
+  host build, which puts it on the host Serial. Frames are packed and checked
+  with the crc16() and buffer_*() of VescUartControl, so the model and the
+  firmware use the same code.
+
+  vescReceive() takes the bytes the controller sent, whole or in pieces.
+  COMM_GET_VALUES leaves the framed answer, in the layout ProcessReadPacket()
+  reads, in answer[]; the caller sends it and sets answerLen back to 0. The
+  other commands drive the model:
+
+    COMM_SET_CURRENT        motor current
+    COMM_SET_CURRENT_BRAKE  current against the direction of rotation
+    COMM_SET_DUTY           current to reach duty * v_in * kv
+    COMM_SET_RPM            current to reach the erpm
+    COMM_ALIVE              keeps the last command alive
+
+  Every command and every broken frame is passed to onCommand, if set.
+  vescStep() moves the model on by one ms. Like the VESC the motor is
+  released when no command came for 1 s. The battery has an internal
+  resistance, the board a constant load and drag, vescSet() changes them
+  by name:
+
+    v_batt   open circuit voltage [V]      (42)
+    r_batt   internal resistance [Ohm]     (0.1)
+    load     hill / rider load [A]         (1)
+*/
+
+#ifndef vescmodel_h
+#define vescmodel_h
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "buffer.h"
+#include "crc.h"
+#include "datatypes.h"
+
+static const double vescKv = 1000;          // [erpm/V] at full duty
+static const double vescAccel = 400;        // [erpm/s per A]
+static const double vescDrag = 0.0004;      // [A per erpm]
+static const double vescMaxCurrent = 60;    // [A] of the speed controllers
+static const double vescKpSpeed = 0.02;     // [A per erpm]
+static const uint32_t vescCmdTimeout = 1000; // [ms]
+
+enum { VESC_OFF, VESC_CURRENT, VESC_BRAKE, VESC_DUTY, VESC_RPM };
+
+struct vescModel {
+    // Battery and board, see vescSet()
+    double vBatt, rBatt, load;
+    // Last command
+    int mode;          // VESC_OFF ...
+    double set;        // A, duty or erpm
+    uint32_t lastCmd;  // [ms]
+    // What COMM_GET_VALUES reports
+    double currentMotor, currentIn, duty, rpm, vIn;
+    double ah, ahCharged, wh, whCharged, tacho, tachoAbs;
+    // Receiving
+    uint8_t frame[262];
+    int have, need;
+    // Framed answer to the last COMM_GET_VALUES, 0 = none
+    uint8_t answer[262];
+    int answerLen;
+    // Gets every command with its value (A, duty or erpm) and valid set, and
+    // every broken frame (bad_crc, unknown_<id>, short_<name>) with its length
+    void (*onCommand)(void *ctx, uint32_t ms, const char *name, double value, bool valid);
+    void *ctx;
+};
+
+static inline void vescInit(vescModel *m)
+{
+    memset(m, 0, sizeof(vescModel));
+    m->vBatt = m->vIn = 42;
+    m->rBatt = 0.1;
+    m->load = 1;
+    m->need = 2;
+}
+
+// Sets a battery or board value by its script name, false for an unknown name
+static inline bool vescSet(vescModel *m, const char *name, double value)
+{
+    if (!strcmp(name, "v_batt"))
+        m->vBatt = value;
+    else if (!strcmp(name, "r_batt"))
+        m->rBatt = value;
+    else if (!strcmp(name, "load"))
+        m->load = value;
+    else
+        return false;
+    return true;
+}
+
+// One ms of the model, ending at ms
+static inline void vescStep(vescModel *m, uint32_t ms)
+{
+    const double dt = 0.001;
+    double current = 0;
+
+    if (m->mode != VESC_OFF && ms - m->lastCmd > vescCmdTimeout)
+        m->mode = VESC_OFF;
+    switch (m->mode) {
+    case VESC_CURRENT:
+        current = m->set;
+        break;
+    case VESC_BRAKE:
+        current = m->rpm > 0 ? -m->set : m->rpm < 0 ? m->set : 0;
+        break;
+    case VESC_DUTY:
+        current = (m->set * m->vIn * vescKv - m->rpm) * vescKpSpeed;
+        break;
+    case VESC_RPM:
+        current = (m->set - m->rpm) * vescKpSpeed;
+        break;
+    }
+    if (current > vescMaxCurrent) current = vescMaxCurrent;
+    if (current < -vescMaxCurrent) current = -vescMaxCurrent;
+
+    double drive = current - m->rpm * vescDrag - (m->rpm > 0 ? m->load : m->rpm < 0 ? -m->load : 0);
+    double rpm = m->rpm + drive * vescAccel * dt;
+    if ((m->mode == VESC_OFF || m->mode == VESC_BRAKE) && rpm * m->rpm < 0)
+        rpm = 0; // coasting and braking don't reverse
+    m->rpm = rpm;
+
+    m->duty = m->vIn > 0 ? m->rpm / (m->vIn * vescKv) : 0;
+    if (m->duty > 1) m->duty = 1;
+    if (m->duty < -1) m->duty = -1;
+    m->currentMotor = current;
+    m->currentIn = current * fabs(m->duty);
+    m->vIn = m->vBatt - m->currentIn * m->rBatt;
+
+    double ah = m->currentIn * dt / 3600;
+    if (ah > 0) {
+        m->ah += ah;
+        m->wh += ah * m->vIn;
+    } else {
+        m->ahCharged -= ah;
+        m->whCharged -= ah * m->vIn;
+    }
+    double pulses = m->rpm / 60 * dt * 6; // 6 tacho steps per electrical turn
+    m->tacho += pulses;
+    m->tachoAbs += fabs(pulses);
+}
+
+// Frames the payload like PackSendPayload()
+static inline int vescPack(const uint8_t *payload, int len, uint8_t *frame)
+{
+    uint16_t crc = crc16((unsigned char *)payload, len);
+    int n = 0;
+    frame[n++] = 2;
+    frame[n++] = len;
+    memcpy(frame + n, payload, len);
+    n += len;
+    frame[n++] = crc >> 8;
+    frame[n++] = crc & 0xFF;
+    frame[n++] = 3;
+    return n;
+}
+
+// Answer to COMM_GET_VALUES, the layout ProcessReadPacket() expects
+static inline int vescValues(const vescModel *m, uint8_t *payload)
+{
+    int32_t ind = 0;
+    payload[ind++] = COMM_GET_VALUES;
+    for (int i = 0; i < 7; i++)
+        buffer_append_float16(payload, 30.0, 10.0, &ind); // temp_mos1..6, temp_pcb
+    buffer_append_float32(payload, m->currentMotor, 100.0, &ind);
+    buffer_append_float32(payload, m->currentIn, 100.0, &ind);
+    buffer_append_float16(payload, m->duty, 1000.0, &ind);
+    buffer_append_int32(payload, (int32_t)m->rpm, &ind);
+    buffer_append_float16(payload, m->vIn, 10.0, &ind);
+    buffer_append_float32(payload, m->ah, 10000.0, &ind);
+    buffer_append_float32(payload, m->ahCharged, 10000.0, &ind);
+    buffer_append_float32(payload, m->wh, 10000.0, &ind);
+    buffer_append_float32(payload, m->whCharged, 10000.0, &ind);
+    buffer_append_int32(payload, (int32_t)m->tacho, &ind);
+    buffer_append_int32(payload, (int32_t)m->tachoAbs, &ind);
+    payload[ind++] = 0; // fault code
+    return ind;
+}
+
+static inline void vescReport(vescModel *m, uint32_t ms, const char *name, double value, bool valid)
+{
+    if (m->onCommand) m->onCommand(m->ctx, ms, name, value, valid);
+}
+
+static inline void vescCommand(vescModel *m, const uint8_t *payload, int len, uint32_t ms)
+{
+    int32_t ind = 1;
+    const char *name;
+    int mode = m->mode;
+    double value = 0;
+
+    switch (payload[0]) {
+    case COMM_GET_VALUES: {
+        uint8_t values[64];
+        if (!m->answerLen) // still sending the last one, a VESC drops it as well
+            m->answerLen = vescPack(values, vescValues(m, values), m->answer);
+        return;
+    }
+    case COMM_SET_CURRENT:
+        name = "current";
+        value = buffer_get_int32(payload, &ind) / 1000.0;
+        mode = VESC_CURRENT;
+        break;
+    case COMM_SET_CURRENT_BRAKE:
+        name = "brake";
+        value = buffer_get_int32(payload, &ind) / 1000.0;
+        mode = VESC_BRAKE;
+        break;
+    case COMM_SET_DUTY:
+        name = "duty";
+        value = buffer_get_int32(payload, &ind) / 100000.0;
+        mode = VESC_DUTY;
+        break;
+    case COMM_SET_RPM:
+        name = "rpm";
+        value = buffer_get_int32(payload, &ind);
+        mode = VESC_RPM;
+        break;
+    case COMM_ALIVE:
+        name = "alive";
+        break;
+    default: {
+        char unknown[16];
+        snprintf(unknown, sizeof(unknown), "unknown_%d", payload[0]);
+        vescReport(m, ms, unknown, len, false);
+        return;
+    }
+    }
+    if (len < ind) {
+        char shortName[16];
+        snprintf(shortName, sizeof(shortName), "short_%s", name);
+        vescReport(m, ms, shortName, len, false);
+        return;
+    }
+    if (payload[0] != COMM_ALIVE) {
+        m->mode = mode;
+        m->set = value;
+    }
+    m->lastCmd = ms;
+    vescReport(m, ms, name, value, true);
+}
+
+// Bytes from the controller, received at ms
+static inline void vescReceive(vescModel *m, const uint8_t *data, int len, uint32_t ms)
+{
+    for (int i = 0; i < len; i++) {
+        // 2, len, payload, crc, 3 - anything else restarts at the next 2
+        if (m->have == 0 && data[i] != 2)
+            continue;
+        m->frame[m->have++] = data[i];
+        if (m->have == 2)
+            m->need = m->frame[1] + 5;
+        if (m->have < m->need)
+            continue;
+        if (m->frame[m->need - 1] == 3 &&
+            crc16(m->frame + 2, m->frame[1]) == (m->frame[m->need - 3] << 8 | m->frame[m->need - 2]))
+            vescCommand(m, m->frame + 2, m->frame[1], ms);
+        else
+            vescReport(m, ms, "bad_crc", m->frame[1], false);
+        m->have = 0;
+        m->need = 2;
+    }
+}
+
+#endif